@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <vector>
 #include <string>
 
@@ -9,50 +10,42 @@ namespace LapTimeSim {
  * @brief Represents the vehicle's instantaneous state during simulation
  */
 struct SimulationState {
-    // Position
+    // --- Hot fields: read by the integration/physics step ---
+    // Grouped at the front so the per-step read set fits in a single
+    // 64 B cache line when states are handled as values.
     double s;                   // Arc length along track (m)
+    double v;                   // Velocity magnitude (m/s)
+    double ax;                  // Longitudinal acceleration (m/s²)
+    double ay;                  // Lateral acceleration (m/s²)
+    double rpm;                 // Engine RPM
+    int gear;                   // Current gear (0 = neutral, 1-N = gears)
+
+    // --- Warm fields: forces used while computing the step ---
+    double az;                  // Vertical acceleration (m/s²)
+    double engine_torque;       // Current engine torque (Nm)
+    double wheel_force;         // Force at wheels (N)
+    double drag_force;          // Aerodynamic drag force (N)
+    double downforce;           // Aerodynamic downforce (N)
+    double tire_force_x;        // Longitudinal tire force (N)
+    double tire_force_y;        // Lateral tire force (N)
+    double vertical_load;       // Total vertical load on tires (N)
+
+    // --- Cold fields: diagnostics / logging / UI only ---
     double n;                   // Lateral offset from centerline (m) - positive = left
     double x;                   // Global X position (m)
     double y;                   // Global Y position (m)
     double z;                   // Global Z position (elevation) (m)
-    
-    // Velocity and acceleration
-    double v;                   // Velocity magnitude (m/s)
     double v_kmh;               // Velocity (km/h) for convenience
-    double ax;                  // Longitudinal acceleration (m/s²)
-    double ay;                  // Lateral acceleration (m/s²)
-    double az;                  // Vertical acceleration (m/s²)
-    
-    // G-forces
     double gx;                  // Longitudinal G-force
     double gy;                  // Lateral G-force
     double gz;                  // Vertical G-force
     double g_total;             // Total G-force magnitude
-    
-    // Control inputs
     double throttle;            // Throttle position (0-1)
     double brake;               // Brake pressure (0-1)
     double steering_angle;      // Steering angle (radians)
-    
-    // Powertrain state
-    int gear;                   // Current gear (0 = neutral, 1-N = gears)
-    double rpm;                 // Engine RPM
-    double engine_torque;       // Current engine torque (Nm)
-    double wheel_force;         // Force at wheels (N)
-    
-    // Forces
-    double drag_force;          // Aerodynamic drag force (N)
-    double downforce;           // Aerodynamic downforce (N)
-    double tire_force_x;        // Longitudinal tire force (N)
-    double tire_force_y;        // Lateral tire force (N)
-    double vertical_load;       // Total vertical load on tires (N)
-    
-    // Track properties at current position
     double curvature;           // Track curvature at current position (1/m)
     double radius;              // Turn radius (m) - infinite for straight
     double banking_angle;       // Track banking angle (radians)
-    
-    // Time
     double timestamp;           // Time since lap start (s)
     
     /**
@@ -63,7 +56,7 @@ struct SimulationState {
     /**
      * @brief Convert velocity to km/h
      */
-    void updateVelocityKmh() { v_kmh = v * 3.6; }
+    void updateVelocityKmh() noexcept { v_kmh = v * 3.6; }
     
     /**
      * @brief Calculate G-forces from accelerations
@@ -76,63 +69,127 @@ struct SimulationState {
      */
     void reset();
     
+    /**
+     * @brief Format a state summary into a caller-supplied buffer
+     * Allocation-free; suited to per-state console logging
+     * @return Number of characters written (snprintf semantics)
+     */
+    int toString(char* buf, size_t buf_size) const;
+
     /**
      * @brief Get a string summary of the current state
      */
     std::string toString() const;
 };
 
+/**
+ * @brief Column-oriented storage for lap telemetry
+ *
+ * One vector per SimulationState field. Post-processing reductions
+ * (max speed, max G-force) read only one or two fields per sample;
+ * keeping each field contiguous makes those sweeps unit-stride instead
+ * of pulling full SimulationState structs through the cache.
+ *
+ * Columns that exist only for display/export (G-forces, control inputs,
+ * per-sample forces, rpm) are stored as float: single precision is far
+ * beyond plotting accuracy and halves the memory traffic of the
+ * telemetry sweeps. Solver-precision quantities (position, velocity,
+ * acceleration, track geometry) stay double.
+ */
+struct LapResultColumns {
+    // Position
+    std::vector<double> s, n, x, y, z;
+
+    // Velocity and acceleration
+    std::vector<double> v, ax, ay, az;
+    std::vector<float> v_kmh;
+
+    // G-forces
+    std::vector<float> gx, gy, gz, g_total;
+
+    // Control inputs
+    std::vector<float> throttle, brake, steering_angle;
+
+    // Powertrain state
+    std::vector<int> gear;
+    std::vector<float> rpm, engine_torque, wheel_force;
+
+    // Forces
+    std::vector<float> drag_force, downforce, tire_force_x, tire_force_y, vertical_load;
+
+    // Track properties
+    std::vector<double> curvature, radius, banking_angle;
+
+    // Time
+    std::vector<double> timestamp;
+};
+
 /**
  * @brief Container for complete lap simulation results
+ *
+ * Internally stores telemetry as columns (see LapResultColumns).
+ * SimulationState remains the value type for adding samples and for
+ * callers that need a full per-sample view via at().
  */
 class LapResult {
 public:
     LapResult();
     ~LapResult() = default;
-    
+
+    /**
+     * @brief Reserve capacity for n samples in every column
+     * Call before the logging loop to avoid geometric reallocation
+     */
+    void reserve(size_t n);
+
     /**
-     * @brief Add a simulation state snapshot
+     * @brief Add a simulation state snapshot (scattered into columns)
      */
     void addState(const SimulationState& state);
-    
+
     /**
-     * @brief Get all states
+     * @brief Gather a full state at the given sample index
      */
-    const std::vector<SimulationState>& getStates() const { return states_; }
-    
+    SimulationState at(size_t index) const;
+
+    /**
+     * @brief Get raw column storage (for export and reductions)
+     */
+    const LapResultColumns& getColumns() const noexcept { return columns_; }
+
     /**
      * @brief Get total lap time
      */
-    double getLapTime() const { return lap_time_; }
-    void setLapTime(double time) { lap_time_ = time; }
-    
+    double getLapTime() const noexcept { return lap_time_; }
+    void setLapTime(double time) noexcept { lap_time_ = time; }
+
     /**
      * @brief Get maximum speed achieved
      */
     double getMaxSpeed() const;
-    
+
     /**
      * @brief Get average speed
      */
     double getAverageSpeed() const;
-    
+
     /**
      * @brief Get maximum G-forces
      */
     void getMaxGForces(double& max_gx, double& max_gy, double& max_g_total) const;
-    
+
     /**
      * @brief Clear all data
      */
     void clear();
-    
+
     /**
      * @brief Get number of data points
      */
-    size_t size() const { return states_.size(); }
+    size_t size() const noexcept { return columns_.v.size(); }
 
 private:
-    std::vector<SimulationState> states_;
+    LapResultColumns columns_;
     double lap_time_;
 };
 
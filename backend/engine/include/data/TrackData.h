@@ -24,23 +24,60 @@ struct TrackPoint {
     double kappa;          // Curvature = 1/R (1/m), positive = left turn
     double ds;             // Segment length to next point (m)
     
-    TrackPoint() : x(0), y(0), z(0), w_tr_left(0), w_tr_right(0), 
+    TrackPoint() : x(0), y(0), z(0), w_tr_left(0), w_tr_right(0),
                    banking(0), s(0), psi(0), kappa(0), ds(0) {}
 };
 
+/**
+ * @brief Column-oriented storage for track points
+ *
+ * One contiguous vector per TrackPoint field. The preprocessing passes
+ * (arc length, heading, curvature) and the solver's curvature lookups
+ * each touch only two or three fields per point; parallel arrays keep
+ * those sweeps unit-stride and auto-vectorizable instead of striding
+ * over 80-byte TrackPoint structs.
+ */
+struct TrackColumns {
+    std::vector<double> x, y, z;
+    std::vector<double> w_tr_left, w_tr_right, banking;
+    std::vector<double> s, psi, kappa, ds;
+};
+
+/**
+ * @brief Local track geometry at an arc-length position
+ *
+ * The three fields the vehicle dynamics actually need at a query point.
+ * 24 bytes, returned by value in registers - much cheaper than gathering
+ * a full TrackPoint when only the geometry is wanted.
+ */
+struct TrackLocalGeometry {
+    double kappa;      // Curvature (1/m)
+    double psi;        // Heading angle (radians)
+    double banking;    // Banking angle (radians)
+};
+
 /**
  * @brief Complete track representation with geometric properties
+ *
+ * Points are stored as columns (see TrackColumns); TrackPoint is the
+ * per-point value type gathered on demand by getPoint/interpolateAt.
  */
 class TrackData {
 public:
     TrackData();
     ~TrackData() = default;
     
+    /**
+     * @brief Reserve capacity for n points in every column
+     * Call before the addPoint loop to avoid geometric reallocation
+     */
+    void reserve(size_t n);
+
     /**
      * @brief Add a raw track point (before preprocessing)
      */
-    void addPoint(double x, double y, double z, 
-                  double w_left, double w_right, 
+    void addPoint(double x, double y, double z,
+                  double w_left, double w_right,
                   double banking);
     
     /**
@@ -50,20 +87,49 @@ public:
     void preprocess();
     
     /**
-     * @brief Get track point at specific index
+     * @brief Get track point at specific index (gathered from columns)
      */
-    const TrackPoint& getPoint(size_t index) const;
+    TrackPoint getPoint(size_t index) const;
     
     /**
      * @brief Get track point interpolated at specific arc length
      */
     TrackPoint interpolateAt(double s) const;
-    
+
+    /**
+     * @brief interpolateAt without the s-normalization
+     * For callers that already guarantee 0 <= s < total length, e.g.
+     * the solver's sweep over the track's own arc-length column
+     */
+    TrackPoint interpolateAtUnchecked(double s) const;
+
+    /**
+     * @brief interpolateAt with a caller-owned cursor
+     * For monotone sweeps over s: the cursor usually lands on the
+     * current or next segment, skipping the binary search entirely.
+     * Pass the same hint variable (initially 0) across the sweep.
+     */
+    TrackPoint interpolateAtCursor(double s, size_t& hint) const;
+
+
     /**
      * @brief Get curvature at specific arc length (interpolated)
      */
     double getCurvatureAt(double s) const;
-    
+
+    /**
+     * @brief Get banking angle at specific arc length (interpolated)
+     */
+    double getBankingAt(double s) const;
+
+    /**
+     * @brief Get curvature, heading, and banking at specific arc length
+     * One index search and three column reads instead of a full
+     * TrackPoint gather
+     */
+    TrackLocalGeometry getLocalGeometryAt(double s) const;
+
+
     /**
      * @brief Check if position (s, n) is within track boundaries
      * @param s Arc length position
@@ -79,13 +145,13 @@ public:
     /**
      * @brief Get number of track points
      */
-    size_t getNumPoints() const { return points_.size(); }
-    
+    size_t getNumPoints() const { return columns_.x.size(); }
+
     /**
-     * @brief Get all track points (const reference)
+     * @brief Get raw column storage (const reference)
      */
-    const std::vector<TrackPoint>& getPoints() const { return points_; }
-    
+    const TrackColumns& getColumns() const { return columns_; }
+
     /**
      * @brief Get track name
      */
@@ -98,10 +164,16 @@ public:
     bool isPreprocessed() const { return preprocessed_; }
 
 private:
-    std::vector<TrackPoint> points_;
+    TrackColumns columns_;
     double total_length_;
+    double inv_total_length_;   // 1 / total_length_, set with it
     bool preprocessed_;
     std::string track_name_;
+
+    // Cursor for findIndexAt: solver queries advance monotonically in s,
+    // so remembering the last hit turns the binary search into an
+    // amortized O(1) forward walk
+    mutable size_t last_index_hint_;
     
     /**
      * @brief Calculate arc length for all points
@@ -120,13 +192,39 @@ private:
     
     /**
      * @brief Normalize angles to [-π, π]
-     */
-    static double normalizeAngle(double angle);
-    
+     * Branchless: one round + fused multiply-add instead of the
+     * classic while-loops, whose iteration count is data-dependent and
+     * mispredicts inside the curvature sweep
+     */
+    static double normalizeAngle(double angle) noexcept {
+        constexpr double TWO_PI = 2.0 * 3.14159265358979323846;
+        constexpr double INV_TWO_PI = 1.0 / TWO_PI;
+        return std::fma(-TWO_PI, std::round(angle * INV_TWO_PI), angle);
+    }
+    
+    /**
+     * @brief Wrap arc length into [0, total_length_)
+     * One floor and a multiply-subtract against the cached reciprocal,
+     * replacing while-loops whose trip count grows with |s|
+     */
+    double normalizeS(double s) const noexcept {
+        s -= total_length_ * std::floor(s * inv_total_length_);
+        // floor can land exactly on the upper bound when s is a hair
+        // below a lap multiple; fold it back like the old loop did
+        return (s >= total_length_) ? s - total_length_ : s;
+    }
+
     /**
      * @brief Find index of point closest to given arc length
      */
     size_t findIndexAt(double s) const;
+
+    /**
+     * @brief Interpolate between point i and its successor at arc length s
+     * Shared by interpolateAt and interpolateAtCursor; assumes s is
+     * normalized and i is the segment containing s
+     */
+    TrackPoint interpolateSegment(double s, size_t i) const;
 };
 
 } // namespace LapTimeSim
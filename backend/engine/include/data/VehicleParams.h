@@ -1,6 +1,6 @@
 #pragma once
 
-#include <map>
+#include <utility>
 #include <vector>
 #include <string>
 
@@ -15,7 +15,7 @@ struct AeroParams {
     double frontal_area;    // Reference area (m²)
     double air_density;     // Air density ρ (kg/m³), typically 1.225 at sea level
     
-    AeroParams() : Cl(-3.0), Cd(0.8), frontal_area(1.5), air_density(1.225) {}
+    constexpr AeroParams() : Cl(-3.0), Cd(0.8), frontal_area(1.5), air_density(1.225) {}
 };
 
 /**
@@ -27,14 +27,17 @@ struct TireParams {
     double load_sensitivity;        // Load sensitivity factor (0-1)
     double tire_radius;            // Effective rolling radius (m)
     
-    TireParams() : mu_x(1.6), mu_y(1.8), load_sensitivity(0.9), tire_radius(0.3) {}
+    constexpr TireParams() : mu_x(1.6), mu_y(1.8), load_sensitivity(0.9), tire_radius(0.3) {}
 };
 
 /**
  * @brief Powertrain parameters
  */
 struct PowertrainParams {
-    std::map<double, double> engine_torque_curve;  // RPM -> Torque (Nm)
+    // RPM -> Torque (Nm) samples, kept sorted by RPM. A flat sorted
+    // vector keeps lookups contiguous (one cache line typically holds
+    // the whole curve) instead of chasing map nodes across the heap.
+    std::vector<std::pair<double, double>> engine_torque_curve;
     std::vector<double> gear_ratios;               // Gear ratios (higher = more torque)
     double final_drive_ratio;                      // Final drive ratio
     double drivetrain_efficiency;                  // Power transmission efficiency (0-1)
@@ -43,17 +46,47 @@ struct PowertrainParams {
     double shift_time;                             // Time to shift gears (s)
     
     PowertrainParams() : final_drive_ratio(3.5), drivetrain_efficiency(0.95),
-                         max_rpm(15000), min_rpm(4000), shift_time(0.05) {}
-    
+                         max_rpm(15000), min_rpm(4000), shift_time(0.05),
+                         cached_max_power_(-1.0),
+                         cached_rpm_coef_(0.0), cached_rpm_coef_radius_(-1.0) {}
+
     /**
      * @brief Get engine torque at specific RPM (interpolated)
      */
     double getTorqueAt(double rpm) const;
+
+    /**
+     * @brief Get peak engine power (W, before drivetrain losses)
+     * Scans the torque curve once and caches the result; callers that
+     * mutate engine_torque_curve afterwards must reset the cache via
+     * invalidateCaches()
+     */
+    double getMaxEnginePower() const;
+
+    /**
+     * @brief Drop cached derived values after editing the curve
+     */
+    void invalidateCaches() {
+        cached_max_power_ = -1.0;
+        cached_rpm_coef_radius_ = -1.0;
+    }
     
     /**
      * @brief Get optimal gear for given velocity and target RPM
      */
     int getOptimalGear(double velocity, double tire_radius, double target_rpm) const;
+
+private:
+    // Lazily computed peak power; -1 marks "not computed yet".
+    // mutable so the const getter can fill it on first use.
+    mutable double cached_max_power_;
+
+    // rpm-per-velocity-per-ratio coefficient for getOptimalGear,
+    // 60·final_drive / (2π·r). The tire radius lives outside this
+    // struct and arrives as an argument, so the cache is keyed on it;
+    // a radius of -1 marks "not computed yet".
+    mutable double cached_rpm_coef_;
+    mutable double cached_rpm_coef_radius_;
 };
 
 /**
@@ -65,7 +98,7 @@ struct MassParams {
     double wheelbase;               // Distance between front and rear axles (m)
     double weight_distribution;     // Front weight distribution (0-1), e.g., 0.45 = 45% front
     
-    MassParams() : mass(800), cog_height(0.3), wheelbase(2.5), weight_distribution(0.45) {}
+    constexpr MassParams() : mass(800), cog_height(0.3), wheelbase(2.5), weight_distribution(0.45) {}
 };
 
 /**
@@ -75,7 +108,7 @@ struct BrakeParams {
     double max_brake_force;         // Maximum brake force (N)
     double brake_bias;              // Front brake distribution (0-1), e.g., 0.6 = 60% front
     
-    BrakeParams() : max_brake_force(20000), brake_bias(0.6) {}
+    constexpr BrakeParams() : max_brake_force(20000), brake_bias(0.6) {}
 };
 
 /**
@@ -105,7 +138,7 @@ public:
     /**
      * @brief Get vehicle name/description
      */
-    const std::string& getName() const { return vehicle_name_; }
+    const std::string& getName() const noexcept { return vehicle_name_; }
     void setName(const std::string& name) { vehicle_name_ = name; }
     
     /**
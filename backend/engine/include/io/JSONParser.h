@@ -3,10 +3,19 @@
 #include "data/TrackData.h"
 #include "data/VehicleParams.h"
 #include <string>
-#include <json/json.h>
+#include <vector>
 
 namespace LapTimeSim {
 
+/**
+ * @brief One entry of a batch manifest (see JSONParser::parseBatchManifest)
+ */
+struct BatchJob {
+    std::string track_file;    // Track CSV or JSON path
+    std::string vehicle_file;  // Vehicle JSON path
+    std::string csv_output;    // Optional explicit telemetry CSV path
+};
+
 /**
  * @brief JSON parser for track and vehicle configuration files
  * 
@@ -91,27 +100,22 @@ public:
      */
     static VehicleParams parseVehicleJSON(const std::string& filepath);
 
-private:
-    /**
-     * @brief Read JSON file and return root value
-     */
-    static Json::Value readJSONFile(const std::string& filepath);
-    
-    /**
-     * @brief Get double value with default
-     */
-    static double getDouble(const Json::Value& value, const std::string& key, double default_val);
-    
-    /**
-     * @brief Get int value with default
-     */
-    static int getInt(const Json::Value& value, const std::string& key, int default_val);
-    
     /**
-     * @brief Get string value with default
+     * @brief Parse a batch manifest listing multiple simulation jobs
+     *
+     * Expected format:
+     * {
+     *   "jobs": [
+     *     {"track": "tracks/monza.csv", "vehicle": "cars/f1.json",
+     *      "csv": "out/monza.csv"},
+     *     ...
+     *   ]
+     * }
+     * "csv" is optional; jobs without it get an auto-generated filename.
+     * @param filepath Path to manifest JSON file
+     * @return List of jobs in manifest order
      */
-    static std::string getString(const Json::Value& value, const std::string& key, 
-                                 const std::string& default_val);
+    static std::vector<BatchJob> parseBatchManifest(const std::string& filepath);
 };
 
 } // namespace LapTimeSim
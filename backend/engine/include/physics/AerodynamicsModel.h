@@ -1,6 +1,7 @@
 #pragma once
 
 #include "data/VehicleParams.h"
+#include <cmath>
 
 namespace LapTimeSim {
 
@@ -24,51 +25,103 @@ public:
      * @brief Calculate drag force at given velocity
      * @param v Velocity (m/s)
      * @return Drag force in Newtons (always positive, opposes motion)
+     *
+     * Defined in the header (with the other scalar getters) so calling
+     * loops in other translation units can inline the k*v² form and
+     * vectorize without LTO.
      */
-    double getDragForce(double v) const;
-    
+    double getDragForce(double v) const noexcept {
+        return drag_k_ * v * v;
+    }
+
     /**
      * @brief Calculate downforce at given velocity
      * @param v Velocity (m/s)
      * @return Downforce in Newtons (positive = pushes car down)
      * Note: Cl is typically negative, so this returns -F_lift
      */
-    double getDownforce(double v) const;
-    
+    double getDownforce(double v) const noexcept {
+        return down_k_ * v * v;
+    }
+
+    /**
+     * @brief Calculate drag force and downforce from a single v²
+     * @param v Velocity (m/s)
+     * @param drag Output drag force (N)
+     * @param down Output downforce (N)
+     */
+    void getDragAndDownforce(double v, double& drag, double& down) const noexcept {
+        double v2 = v * v;
+        drag = drag_k_ * v2;
+        down = down_k_ * v2;
+    }
+
     /**
      * @brief Calculate total vertical load including weight and downforce
      * @param v Velocity (m/s)
      * @param mass Vehicle mass (kg)
      * @param g Gravitational acceleration (m/s²)
      * @return Total vertical force on tires in Newtons
+     *
+     * Weight + downforce as one fused multiply-add (single rounding,
+     * one instruction on FMA hardware)
      */
-    double getTotalVerticalLoad(double v, double mass, double g = 9.81) const;
-    
+    double getTotalVerticalLoad(double v, double mass, double g = 9.81) const noexcept {
+        return std::fma(mass, g, getDownforce(v));
+    }
+
     /**
      * @brief Calculate drag power requirement
      * @param v Velocity (m/s)
      * @return Power needed to overcome drag in Watts
      */
-    double getDragPower(double v) const;
+    double getDragPower(double v) const noexcept {
+        return getDragForce(v) * v;
+    }
+
+    /**
+     * @brief Calculate drag force for a batch of velocities
+     * Tight k*v*v loop over contiguous arrays - SIMD-friendly for
+     * velocity sweeps such as GGV generation
+     * @param v Input velocities (m/s)
+     * @param out Output drag forces (N)
+     * @param n Number of elements
+     */
+    void getDragForceBatch(const double* v, double* out, size_t n) const noexcept;
+
+    /**
+     * @brief Calculate downforce for a batch of velocities
+     */
+    void getDownforceBatch(const double* v, double* out, size_t n) const noexcept;
     
     /**
      * @brief Update aerodynamic parameters
      */
-    void setParams(const AeroParams& params) { params_ = params; }
-    
+    void setParams(const AeroParams& params) {
+        params_ = params;
+        rebuildCoefficients();
+    }
+
     /**
      * @brief Get current parameters
      */
-    const AeroParams& getParams() const { return params_; }
+    const AeroParams& getParams() const noexcept { return params_; }
 
 private:
     AeroParams params_;
-    
+
+    // Cached force coefficients: F = k * v². Pure functions of the
+    // parameters, so compute them once instead of per call.
+    double drag_k_;   // 0.5 × ρ × A × Cd
+    double down_k_;   // -0.5 × ρ × A × Cl (positive for downforce)
+
     /**
-     * @brief Calculate the common aerodynamic coefficient: 0.5 × ρ × A
+     * @brief Rebuild the cached drag/downforce coefficients from params
      */
-    double getAeroCoefficient() const {
-        return 0.5 * params_.air_density * params_.frontal_area;
+    void rebuildCoefficients() noexcept {
+        double aero_k = 0.5 * params_.air_density * params_.frontal_area;
+        drag_k_ = aero_k * params_.Cd;
+        down_k_ = -aero_k * params_.Cl;
     }
 };
 
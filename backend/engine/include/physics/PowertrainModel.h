@@ -38,7 +38,7 @@ public:
      * @param gear Current gear (1-indexed)
      * @return Engine RPM
      */
-    double getRPM(double v, int gear) const;
+    double getRPM(double v, int gear) const noexcept;
     
     /**
      * @brief Get engine torque at specific RPM
@@ -54,6 +54,20 @@ public:
      * @return Optimal gear number (1-indexed)
      */
     int getOptimalGear(double v) const;
+
+    /**
+     * @brief Optimal gear and resulting RPM for a batch of velocities
+     * Same selection as getOptimalGear, but the gear tables are loaded
+     * once and the binary search is replaced by a branchless prefix
+     * count over the engage speeds - with a handful of gears the
+     * compares are cheaper and vectorize
+     * @param v Velocities (m/s)
+     * @param gears_out Output gear numbers (1-indexed)
+     * @param rpm_out Output engine RPM in the selected gear
+     * @param n Number of points
+     */
+    void getOptimalGearsBulk(const double* v, int* gears_out,
+                             double* rpm_out, size_t n) const;
     
     /**
      * @brief Get maximum wheel force available at given velocity
@@ -62,7 +76,17 @@ public:
      * @return Maximum wheel force in Newtons
      */
     double getMaxWheelForce(double v) const;
-    
+
+    /**
+     * @brief Batched getMaxWheelForce for velocity sweeps
+     * Iterates gear-major so per-gear constants are hoisted out of the
+     * inner loop over velocities
+     * @param v Velocities (m/s), n elements
+     * @param out Maximum wheel forces (N), n elements
+     */
+    void getMaxWheelForceBatch(const double* v, double* out, size_t n) const;
+
+
     /**
      * @brief Get maximum power output
      * @return Maximum power in Watts
@@ -70,10 +94,10 @@ public:
     double getMaxPower() const;
     
     /**
-     * @brief Get RPM at peak power
+     * @brief Get RPM at peak power (cached at construction)
      * @return RPM at maximum power output
      */
-    double getPeakPowerRPM() const;
+    double getPeakPowerRPM() const noexcept;
     
     /**
      * @brief Calculate power at wheels for given velocity and gear
@@ -86,35 +110,96 @@ public:
     /**
      * @brief Update powertrain parameters
      */
-    void setParams(const PowertrainParams& params) { params_ = params; }
-    
+    void setParams(const PowertrainParams& params) {
+        params_ = params;
+        rebuildRatioCache();
+    }
+
     /**
      * @brief Set tire radius
      */
-    void setTireRadius(double radius) { tire_radius_ = radius; }
+    void setTireRadius(double radius) { tire_radius_ = radius; rebuildRatioCache(); }
     
     /**
      * @brief Get current parameters
      */
-    const PowertrainParams& getParams() const { return params_; }
+    const PowertrainParams& getParams() const noexcept { return params_; }
 
 private:
     PowertrainParams params_;
     double tire_radius_;
-    
+
+    // Per-gear total ratios (gear ratio x final drive), precomputed so
+    // the per-step force/RPM path is a plain table lookup
+    std::vector<double> total_ratios_;
+
+    // Per-gear wheel-force factor: ratio x efficiency / tire radius.
+    // With it, getWheelForce is one torque lookup and one multiply.
+    std::vector<double> force_scale_;
+
+    // RPM of the torque curve's peak-power sample, found once in
+    // rebuildRatioCache
+    double peak_power_rpm_ = 0.0;
+
+    // Torque curve resampled onto a uniform RPM grid (~50 RPM step)
+    // covering the curve's span. Lookups become two loads and a lerp
+    // instead of a binary search; the step divides the sample spacing
+    // of typical curves, so the resample reproduces them exactly.
+    std::vector<double> torque_table_;
+    double table_rpm_min_ = 0.0;
+    double table_inv_step_ = 0.0;
+
+    // Gear-selection tables: RPM per unit velocity for each gear, and
+    // the (ascending) speed at which each gear enters the power band.
+    // Turns getOptimalGear into a binary search over a few doubles.
+    std::vector<double> rpm_per_v_;
+    std::vector<double> gear_engage_speeds_;
+
     static constexpr double PI = 3.14159265358979323846;
-    
+
+    // Unit conversions between shaft angular velocity and RPM, folded
+    // to single multiplies
+    static constexpr double RAD_PER_S_TO_RPM = 60.0 / (2.0 * PI);
+    static constexpr double RPM_TO_RAD_PER_S = 1.0 / RAD_PER_S_TO_RPM;
+
+    /**
+     * @brief Rebuild the cached per-gear total ratios from params
+     */
+    void rebuildRatioCache();
+
+    /**
+     * @brief Interpolated torque from the dense uniform table
+     * Clamps to the curve's end values like PowertrainParams::getTorqueAt
+     */
+    double lookupTorque(double rpm) const noexcept {
+        if (torque_table_.empty()) {
+            return 0.0;
+        }
+        double t = (rpm - table_rpm_min_) * table_inv_step_;
+        if (t <= 0.0) {
+            return torque_table_.front();
+        }
+        size_t last = torque_table_.size() - 1;
+        if (t >= static_cast<double>(last)) {
+            return torque_table_.back();
+        }
+        size_t i = static_cast<size_t>(t);
+        double frac = t - static_cast<double>(i);
+        return std::fma(torque_table_[i + 1] - torque_table_[i], frac,
+                        torque_table_[i]);
+    }
+
     /**
      * @brief Get gear ratio for specific gear (including final drive)
      * @param gear Gear number (1-indexed)
      * @return Total gear ratio
      */
-    double getTotalGearRatio(int gear) const;
+    double getTotalGearRatio(int gear) const noexcept;
     
     /**
      * @brief Check if gear is valid
      */
-    bool isValidGear(int gear) const;
+    bool isValidGear(int gear) const noexcept;
 };
 
 } // namespace LapTimeSim
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "data/VehicleParams.h"
+#include <algorithm>
 #include <cmath>
 
 namespace LapTimeSim {
@@ -27,14 +28,14 @@ public:
      * @param Fz Vertical load on tire (N)
      * @return Maximum longitudinal force in Newtons
      */
-    double getMaxLongitudinalForce(double Fz) const;
+    double getMaxLongitudinalForce(double Fz) const noexcept;
     
     /**
      * @brief Get maximum lateral force (pure cornering)
      * @param Fz Vertical load on tire (N)
      * @return Maximum lateral force in Newtons
      */
-    double getMaxLateralForce(double Fz) const;
+    double getMaxLateralForce(double Fz) const noexcept;
     
     /**
      * @brief Get available longitudinal force when already using lateral grip
@@ -43,7 +44,16 @@ public:
      * @param Fy_current Current lateral force being used (N)
      * @return Maximum available longitudinal force in Newtons
      */
-    double getAvailableLongitudinalForce(double Fz, double Fy_current) const;
+    double getAvailableLongitudinalForce(double Fz, double Fy_current) const noexcept {
+        // Friction ellipse: Fx² + Fy² ≤ (μ × Fz)²
+        // Branchless: clamping the discriminant with max(0, ...)
+        // compiles to maxsd + sqrtsd, avoiding an unpredictable branch
+        // in the GGV sweep, and the inline body lets callers' loops
+        // vectorize through it
+        double F_max = getMaxTotalForce(Fz);
+        double d2 = F_max * F_max - Fy_current * Fy_current;
+        return std::sqrt(std::max(0.0, d2));
+    }
     
     /**
      * @brief Get available lateral force when already using longitudinal grip
@@ -51,8 +61,22 @@ public:
      * @param Fx_current Current longitudinal force being used (N)
      * @return Maximum available lateral force in Newtons
      */
-    double getAvailableLateralForce(double Fz, double Fx_current) const;
-    
+    double getAvailableLateralForce(double Fz, double Fx_current) const noexcept {
+        double F_max = getMaxTotalForce(Fz);
+        double d2 = F_max * F_max - Fx_current * Fx_current;
+        return std::sqrt(std::max(0.0, d2));
+    }
+
+    /**
+     * @brief Batched friction-ellipse evaluation for grid sweeps
+     * @param Fz Vertical loads (N), n elements
+     * @param Fy Lateral forces in use (N), n elements
+     * @param out Available longitudinal forces (N), n elements
+     */
+    void getAvailableLongitudinalForceBatch(const double* Fz, const double* Fy,
+                                            double* out, size_t n) const noexcept;
+
+
     /**
      * @brief Calculate effective friction coefficient with load sensitivity
      * Models the non-linear relationship between load and grip
@@ -60,7 +84,9 @@ public:
      * @param base_mu Base friction coefficient
      * @return Effective friction coefficient
      */
-    double getEffectiveMu(double Fz, double base_mu) const;
+    double getEffectiveMu(double Fz, double base_mu) const noexcept {
+        return applyLoadSensitivity(Fz, base_mu);
+    }
     
     /**
      * @brief Check if combined forces are within friction circle
@@ -69,33 +95,70 @@ public:
      * @param Fz Vertical load (N)
      * @return true if forces are within limit, false if exceeding
      */
-    bool isWithinFrictionCircle(double Fx, double Fy, double Fz) const;
+    bool isWithinFrictionCircle(double Fx, double Fy, double Fz) const noexcept;
     
     /**
      * @brief Get the total maximum force the tire can generate
      * @param Fz Vertical load on tire (N)
      * @return Maximum total force in Newtons
      */
-    double getMaxTotalForce(double Fz) const;
+    double getMaxTotalForce(double Fz) const noexcept {
+        // Use the average of longitudinal and lateral mu for total grip
+        // In practice, this could be more sophisticated
+        double mu_avg = (params_.mu_x + params_.mu_y) / 2.0;
+        return getEffectiveMu(Fz, mu_avg) * Fz;
+    }
     
+    /**
+     * @brief Get the squared maximum total force (friction-circle radius²)
+     * For callers that compare against or subtract squared forces -
+     * skips the sqrt/re-square round trip of going through
+     * getAvailableLongitudinalForce with zero lateral force
+     */
+    double getMaxTotalForceSquared(double Fz) const noexcept {
+        double F_max = getMaxTotalForce(Fz);
+        return F_max * F_max;
+    }
+
     /**
      * @brief Update tire parameters
      */
-    void setParams(const TireParams& params) { params_ = params; }
+    void setParams(const TireParams& params) noexcept { params_ = params; rebuildDerived(); }
     
     /**
      * @brief Get current parameters
      */
-    const TireParams& getParams() const { return params_; }
+    const TireParams& getParams() const noexcept { return params_; }
 
 private:
     TireParams params_;
-    
+
+    // Derived constants for the load-sensitivity hot path
+    double exponent_;          // load_sensitivity - 1
+    double inv_fz_reference_;  // 1 / reference load per tire
+
+    /**
+     * @brief Recompute derived constants after a parameter change
+     */
+    void rebuildDerived() noexcept {
+        const double Fz_reference = 2000.0;  // N, approximately 200kg per tire
+        exponent_ = params_.load_sensitivity - 1.0;
+        inv_fz_reference_ = 1.0 / Fz_reference;
+    }
+
     /**
      * @brief Apply load sensitivity factor to friction coefficient
      * Uses a simple model: μ_eff = μ_base × (Fz / Fz_nominal)^(sensitivity - 1)
      */
-    double applyLoadSensitivity(double Fz, double base_mu) const;
+    double applyLoadSensitivity(double Fz, double base_mu) const noexcept {
+        if (Fz <= 0.0) return 0.0;
+
+        double load_ratio = Fz * inv_fz_reference_;
+
+        // x^e = exp2(e * log2(x)) with e cached; avoids std::pow's
+        // general base/exponent handling (50+ cycles)
+        return base_mu * std::exp2(exponent_ * std::log2(load_ratio));
+    }
 };
 
 } // namespace LapTimeSim
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+namespace LapTimeSim {
+
+/**
+ * @brief Minimal std::allocator drop-in with a fixed over-alignment
+ *
+ * Backs the solver's per-point arrays so every vector starts on a cache
+ * line boundary: 4-lane vector loads never split a line, and adjacent
+ * arrays cannot share a line's tail. Uses the aligned operator new
+ * overloads, so the alignment must be a power of two.
+ */
+template <typename T, std::size_t Alignment>
+struct AlignedAllocator {
+    using value_type = T;
+
+    AlignedAllocator() noexcept = default;
+
+    template <typename U>
+    AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept {}
+
+    template <typename U>
+    struct rebind {
+        using other = AlignedAllocator<U, Alignment>;
+    };
+
+    T* allocate(std::size_t n) {
+        void* p = ::operator new(n * sizeof(T), std::align_val_t(Alignment));
+        return static_cast<T*>(p);
+    }
+
+    void deallocate(T* p, std::size_t) noexcept {
+        ::operator delete(p, std::align_val_t(Alignment));
+    }
+
+    friend bool operator==(const AlignedAllocator&, const AlignedAllocator&) noexcept {
+        return true;
+    }
+    friend bool operator!=(const AlignedAllocator&, const AlignedAllocator&) noexcept {
+        return false;
+    }
+};
+
+/// Cache-line-aligned double vector for hot per-point arrays
+using AlignedDoubleVector = std::vector<double, AlignedAllocator<double, 64>>;
+
+} // namespace LapTimeSim
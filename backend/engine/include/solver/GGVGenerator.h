@@ -9,26 +9,17 @@
 
 namespace LapTimeSim {
 
-/**
- * @brief Stores acceleration limits at a specific velocity and lateral acceleration
- */
-struct GGVPoint {
-    double velocity;           // m/s
-    double ay_lateral;         // Lateral acceleration (m/s²)
-    double ax_max_accel;       // Maximum longitudinal acceleration (m/s²)
-    double ax_max_brake;       // Maximum longitudinal deceleration (m/s², negative)
-    
-    GGVPoint() : velocity(0), ay_lateral(0), ax_max_accel(0), ax_max_brake(0) {}
-};
-
 /**
  * @brief Generates and stores the GGV (G-G-Velocity) diagram
- * 
+ *
  * The GGV diagram maps the maximum achievable accelerations for every
  * combination of velocity and lateral acceleration. It represents the
  * performance envelope of the vehicle.
- * 
- * Structure: ggv_map[velocity_index][ay_index] = {ax_max, ax_min}
+ *
+ * The grid is regular in (v, ay), so it is stored as two dense row-major
+ * arrays indexed by [iv * nay + iay]. Lookups compute the cell directly
+ * from (v, ay) - no search needed - and bilinearly interpolate the four
+ * neighboring grid values.
  */
 class GGVGenerator {
 public:
@@ -66,17 +57,58 @@ public:
      * @return Maximum braking deceleration (m/s², negative value)
      */
     double getMaxBraking(double v, double ay) const;
-    
+
     /**
-     * @brief Check if GGV diagram has been generated
+     * @brief Get both acceleration and braking limits at (v, ay)
+     * Shares the cell/index computation between the two grids, so
+     * callers that need the full ax envelope pay for one lookup
+     * @param v Velocity (m/s)
+     * @param ay Lateral acceleration (m/s²)
+     * @param ax_accel Maximum longitudinal acceleration (m/s²)
+     * @param ax_brake Maximum braking deceleration (m/s², negative)
      */
-    bool isGenerated() const { return generated_; }
-    
+    void getMaxAxRange(double v, double ay,
+                       double& ax_accel, double& ax_brake) const;
+
     /**
-     * @brief Get all GGV points (for analysis/plotting)
+     * @brief Acceleration limits for a batch of (v, ay) queries
+     * One bilinear setup per element over contiguous arrays; useful
+     * for whole-profile sweeps where the queries are independent
+     * @param v Velocities (m/s)
+     * @param ay Lateral accelerations (m/s²), absolute values
+     * @param out Output acceleration limits (m/s²)
+     * @param n Number of queries
      */
-    const std::vector<GGVPoint>& getPoints() const { return ggv_points_; }
-    
+    void getMaxAccelerationBulk(const double* v, const double* ay,
+                                double* out, size_t n) const;
+
+    /**
+     * @brief Braking limits for a batch of (v, ay) queries
+     */
+    void getMaxBrakingBulk(const double* v, const double* ay,
+                           double* out, size_t n) const;
+
+    /**
+     * @brief Acceleration limit on the ay = 0 slice
+     * Straight-line fast path: a 1-D lerp along the first grid column,
+     * skipping the bilinear cell setup. Bit-identical to
+     * getMaxAcceleration(v, 0.0).
+     * @param v Velocity (m/s)
+     */
+    double getMaxAccelerationStraight(double v) const;
+
+    /**
+     * @brief Braking limit on the ay = 0 slice
+     * @param v Velocity (m/s)
+     */
+    double getMaxBrakingStraight(double v) const;
+
+
+    /**
+     * @brief Check if GGV diagram has been generated
+     */
+    bool isGenerated() const { return generated_; }
+
     /**
      * @brief Export GGV diagram to CSV file
      * @param filename Output file path
@@ -86,45 +118,66 @@ public:
 private:
     VehicleParams vehicle_;
     AerodynamicsModel aero_model_;
+
+    // Mass constants baked in the ctor so the grid kernels read plain
+    // doubles: the compiler cannot prove vehicle_.mass invariant across
+    // calls into the physics models. F/m divides become multiplies.
+    double mass_;
+    double inv_mass_;
+    double weight_;   // mass_ * g
     TireModel tire_model_;
     PowertrainModel powertrain_model_;
     
-    std::vector<GGVPoint> ggv_points_;
+    // Dense row-major grids: value at (iv, iay) lives at
+    // [iv * row_stride_ + iay]. Rows are padded to a multiple of four
+    // doubles so the 4-wide fill kernel can store full vectors on the
+    // final group of a row without a scalar tail.
+    std::vector<double> ax_accel_grid_;
+    std::vector<double> ax_brake_grid_;
     bool generated_;
-    
+
     // Grid parameters
     double v_min_, v_max_, v_step_;
     double ay_min_, ay_max_, ay_step_;
+    int nv_, nay_;    // Grid dimensions
+    int row_stride_;  // nay_ rounded up to a multiple of 4
     
     /**
      * @brief Calculate maximum acceleration for a specific (v, ay) point
-     * @param v Velocity (m/s)
+     * All v-dependent inputs (vertical load, drag, engine force) are
+     * precomputed per velocity row, so only the tire circle and the
+     * mins remain per cell
      * @param ay Lateral acceleration magnitude (m/s²)
+     * @param Fz_total Precomputed vertical load at v (N)
+     * @param F_drag Precomputed drag force at v (N)
+     * @param Fx_engine Precomputed max engine wheel force at v (N)
      * @return Maximum longitudinal acceleration (m/s²)
      */
-    double calculateMaxAcceleration(double v, double ay) const;
-    
+    double calculateMaxAcceleration(double ay, double Fz_total,
+                                    double F_drag, double Fx_engine) const;
+
     /**
      * @brief Calculate maximum braking for a specific (v, ay) point
      * @param v Velocity (m/s)
      * @param ay Lateral acceleration magnitude (m/s²)
+     * @param Fz_total Precomputed vertical load at v (N)
+     * @param F_drag Precomputed drag force at v (N)
      * @return Maximum braking deceleration (m/s², negative)
      */
-    double calculateMaxBraking(double v, double ay) const;
+    double calculateMaxBraking(double v, double ay,
+                               double Fz_total, double F_drag) const;
     
     /**
-     * @brief Find GGV point by binary search
-     * @param v Velocity
-     * @param ay Lateral acceleration
-     * @return Index in ggv_points_ vector, or -1 if not found
+     * @brief Interpolate a grid bilinearly at (v, ay)
+     * @param grid Either ax_accel_grid_ or ax_brake_grid_
      */
-    int findPointIndex(double v, double ay) const;
-    
+    double interpolateGrid(const std::vector<double>& grid, double v, double ay) const;
+
     /**
-     * @brief Interpolate between GGV points
+     * @brief Interpolate the ay = 0 column of a grid at velocity v
+     * @param grid Either ax_accel_grid_ or ax_brake_grid_
      */
-    double interpolateAcceleration(double v, double ay) const;
-    double interpolateBraking(double v, double ay) const;
+    double interpolateStraight(const std::vector<double>& grid, double v) const;
 };
 
 } // namespace LapTimeSim
@@ -3,7 +3,9 @@
 #include "data/TrackData.h"
 #include "data/VehicleParams.h"
 #include "data/SimulationState.h"
+#include "solver/AlignedAllocator.h"
 #include "solver/GGVGenerator.h"
+#include "solver/SolverKernels.h"
 #include "physics/AerodynamicsModel.h"
 #include "physics/TireModel.h"
 #include "physics/PowertrainModel.h"
@@ -44,7 +46,7 @@ public:
      * @brief Get the computed velocity profile
      * @return Vector of velocities at each track point (m/s)
      */
-    const std::vector<double>& getVelocityProfile() const { return v_optimal_; }
+    const AlignedDoubleVector& getVelocityProfile() const { return v_optimal_; }
     
     /**
      * @brief Get complete simulation result with telemetry
@@ -67,6 +69,13 @@ public:
      */
     int getIterationsUsed() const { return iterations_used_; }
 
+    /**
+     * @brief Enable or disable per-iteration progress output
+     * On by default for interactive runs; batch drivers turn it off so
+     * concurrent jobs do not interleave iteration logs
+     */
+    void setVerbose(bool verbose) { verbose_ = verbose; }
+
 private:
     const TrackData& track_;
     const VehicleParams& vehicle_;
@@ -77,16 +86,41 @@ private:
     std::unique_ptr<PowertrainModel> powertrain_model_;
     
     size_t n_points_;
-    
-    // Velocity profiles from each pass
-    std::vector<double> v_corner_;   // Cornering-limited
-    std::vector<double> v_accel_;    // Acceleration-limited
-    std::vector<double> v_brake_;    // Braking-limited
-    std::vector<double> v_optimal_;  // Final optimal (min of all three)
+
+    // Whether the runtime-dispatched AVX2 kernels may be used on this
+    // CPU; resolved once in the ctor
+    bool use_simd_kernels_;
+    
+    // Velocity profiles. The acceleration- and braking-limited profiles
+    // are pure chains from a single seam value, so only those seams are
+    // kept between iterations; the passes min directly into v_optimal_
+    // instead of materializing three arrays and a combine sweep
+    AlignedDoubleVector v_corner_;   // Cornering-limited
+    AlignedDoubleVector v_optimal_;  // Final optimal (min of all three passes)
+
+    // Solver-local copies of the track columns the integration loops
+    // touch, plus |kappa| precomputed once: the sweeps then read only
+    // contiguous doubles owned by this object
+    AlignedDoubleVector kappa_;
+    AlignedDoubleVector abs_kappa_;
+    AlignedDoubleVector ds_;
+    AlignedDoubleVector two_ds_;  // 2*ds, the v^2 integration factor
+    double v_accel_start_ = 0.0;     // Forward-chain seed (first point)
+    double v_brake_end_ = 0.0;       // Backward-chain seed (last point)
     
     double lap_time_;
     bool converged_;
     int iterations_used_;
+    bool verbose_ = true;  // Progress prints during solve/initialize
+
+    // Cornering-limit coefficients, fixed for the whole solve:
+    // v² = corner_num_ / (corner_coef_a_·|κ| − corner_coef_b_)
+    // Baking μmg, m and the aero term into constants at construction
+    // leaves the per-point work as one multiply, subtract, divide and
+    // sqrt, which the compiler can vectorize
+    double corner_num_;      // μ·m·g
+    double corner_coef_a_;   // m
+    double corner_coef_b_;   // 0.5·μ·ρ·(−Cl)·A
     
     /**
      * @brief Initialize solver and generate GGV diagram
@@ -104,27 +138,22 @@ private:
     
     /**
      * @brief Pass 2: Forward integration (acceleration limit)
-     * 
+     *
      * Starting from first point, integrate forward using maximum acceleration:
      * v²[i+1] = v²[i] + 2 × ax_max × ds[i]
+     * Writes min(v_accel, v_corner) into v_optimal_ as it goes.
      */
     void forwardIntegration();
-    
+
     /**
      * @brief Pass 3: Backward integration (braking limit)
-     * 
+     *
      * Starting from last point, integrate backward using maximum braking:
      * v²[i-1] = v²[i] - 2 × ax_min × ds[i-1]
+     * Mins the braking profile into v_optimal_, completing the combine.
      */
     void backwardIntegration();
-    
-    /**
-     * @brief Combine all three profiles to get optimal velocity
-     * 
-     * v_optimal[i] = min(v_corner[i], v_accel[i], v_brake[i])
-     */
-    void combineProfiles();
-    
+
     /**
      * @brief Calculate total lap time from velocity profile
      * 
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+
+namespace LapTimeSim {
+
+/**
+ * @brief Runtime-dispatched SIMD kernels for the solver's hot sweeps
+ *
+ * The implementations live in SolverKernelsAVX2.cpp, which is compiled
+ * for AVX2+FMA via a function target attribute regardless of the
+ * baseline architecture flags, so portable builds still ship the wide
+ * kernels. Callers must gate every call on avx2Supported(); when the
+ * translation unit is built by a non-GNU compiler the query returns
+ * false and the kernels are never entered.
+ */
+namespace SolverKernels {
+
+/**
+ * @brief Whether the running CPU supports the AVX2 kernels
+ * Checked once via CPUID on first use
+ */
+bool avx2Supported() noexcept;
+
+/**
+ * @brief Cornering-limit velocities for all points
+ *
+ * v_out[i] = sqrt(num / (coef_a * abs_kappa[i] - coef_b)), with the
+ * solver's special cases folded in: |kappa| < 0.002 yields 110 m/s
+ * (straight) and a non-positive denominator yields 100 m/s.
+ *
+ * @param abs_kappa |curvature| per point (1/m)
+ * @param v_out Output velocities (m/s)
+ * @param n Number of points
+ * @param num Baked numerator (mu * m * g)
+ * @param coef_a Baked mass coefficient
+ * @param coef_b Baked aero-downforce coefficient
+ */
+void cornerVelocities(const double* abs_kappa, double* v_out, size_t n,
+                      double num, double coef_a, double coef_b);
+
+/**
+ * @brief Masked sum of ds/v over all points
+ * Entries with v <= 0 contribute exactly zero, matching the scalar
+ * guard. Lane sums are combined pairwise, so the result can differ
+ * from the sequential sum only in the last few ulps.
+ */
+double lapTimeSum(const double* ds, const double* v, size_t n);
+
+} // namespace SolverKernels
+
+} // namespace LapTimeSim
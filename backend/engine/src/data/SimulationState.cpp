@@ -1,9 +1,14 @@
 #include "data/SimulationState.h"
 #include <cmath>
+#include <cstdio>
 #include <sstream>
 #include <iomanip>
 #include <algorithm>
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
 namespace LapTimeSim {
 
 SimulationState::SimulationState() {
@@ -53,72 +58,262 @@ void SimulationState::reset() {
 void SimulationState::updateGForces(double gravity) {
     if (gravity <= 0.0) gravity = 9.81;
     
-    gx = ax / gravity;
-    gy = ay / gravity;
-    gz = az / gravity;
-    g_total = std::sqrt(gx*gx + gy*gy + gz*gz);
+    // One divide instead of three, and the magnitude as a fused
+    // multiply-add chain
+    double inv_gravity = 1.0 / gravity;
+    gx = ax * inv_gravity;
+    gy = ay * inv_gravity;
+    gz = az * inv_gravity;
+    g_total = std::sqrt(std::fma(gx, gx, std::fma(gy, gy, gz * gz)));
+}
+
+int SimulationState::toString(char* buf, size_t buf_size) const {
+    // Direct snprintf into the caller's buffer - no ostringstream
+    // construction or heap allocation per call
+    return std::snprintf(buf, buf_size,
+                         "Time: %.3fs | Speed: %.3f km/h | Pos: (%.3f, %.3f) | "
+                         "G: (%.3f, %.3f) | Throttle: %.3f%% | Brake: %.3f%% | Gear: %d",
+                         timestamp, v_kmh, x, y, gx, gy,
+                         throttle * 100.0, brake * 100.0, gear);
 }
 
 std::string SimulationState::toString() const {
-    std::ostringstream oss;
-    oss << std::fixed << std::setprecision(3);
-    
-    oss << "Time: " << timestamp << "s | "
-        << "Speed: " << v_kmh << " km/h | "
-        << "Pos: (" << x << ", " << y << ") | "
-        << "G: (" << gx << ", " << gy << ") | "
-        << "Throttle: " << (throttle * 100) << "% | "
-        << "Brake: " << (brake * 100) << "% | "
-        << "Gear: " << gear;
-    
-    return oss.str();
+    char buf[256];
+    toString(buf, sizeof(buf));
+    return std::string(buf);
 }
 
 LapResult::LapResult() : lap_time_(0.0) {
 }
 
+void LapResult::reserve(size_t n) {
+    columns_.s.reserve(n);
+    columns_.n.reserve(n);
+    columns_.x.reserve(n);
+    columns_.y.reserve(n);
+    columns_.z.reserve(n);
+
+    columns_.v.reserve(n);
+    columns_.v_kmh.reserve(n);
+    columns_.ax.reserve(n);
+    columns_.ay.reserve(n);
+    columns_.az.reserve(n);
+
+    columns_.gx.reserve(n);
+    columns_.gy.reserve(n);
+    columns_.gz.reserve(n);
+    columns_.g_total.reserve(n);
+
+    columns_.throttle.reserve(n);
+    columns_.brake.reserve(n);
+    columns_.steering_angle.reserve(n);
+
+    columns_.gear.reserve(n);
+    columns_.rpm.reserve(n);
+    columns_.engine_torque.reserve(n);
+    columns_.wheel_force.reserve(n);
+
+    columns_.drag_force.reserve(n);
+    columns_.downforce.reserve(n);
+    columns_.tire_force_x.reserve(n);
+    columns_.tire_force_y.reserve(n);
+    columns_.vertical_load.reserve(n);
+
+    columns_.curvature.reserve(n);
+    columns_.radius.reserve(n);
+    columns_.banking_angle.reserve(n);
+
+    columns_.timestamp.reserve(n);
+}
+
 void LapResult::addState(const SimulationState& state) {
-    states_.push_back(state);
+    columns_.s.push_back(state.s);
+    columns_.n.push_back(state.n);
+    columns_.x.push_back(state.x);
+    columns_.y.push_back(state.y);
+    columns_.z.push_back(state.z);
+
+    columns_.v.push_back(state.v);
+    columns_.v_kmh.push_back(static_cast<float>(state.v_kmh));
+    columns_.ax.push_back(state.ax);
+    columns_.ay.push_back(state.ay);
+    columns_.az.push_back(state.az);
+
+    columns_.gx.push_back(static_cast<float>(state.gx));
+    columns_.gy.push_back(static_cast<float>(state.gy));
+    columns_.gz.push_back(static_cast<float>(state.gz));
+    columns_.g_total.push_back(static_cast<float>(state.g_total));
+
+    columns_.throttle.push_back(static_cast<float>(state.throttle));
+    columns_.brake.push_back(static_cast<float>(state.brake));
+    columns_.steering_angle.push_back(static_cast<float>(state.steering_angle));
+
+    columns_.gear.push_back(state.gear);
+    columns_.rpm.push_back(static_cast<float>(state.rpm));
+    columns_.engine_torque.push_back(static_cast<float>(state.engine_torque));
+    columns_.wheel_force.push_back(static_cast<float>(state.wheel_force));
+
+    columns_.drag_force.push_back(static_cast<float>(state.drag_force));
+    columns_.downforce.push_back(static_cast<float>(state.downforce));
+    columns_.tire_force_x.push_back(static_cast<float>(state.tire_force_x));
+    columns_.tire_force_y.push_back(static_cast<float>(state.tire_force_y));
+    columns_.vertical_load.push_back(static_cast<float>(state.vertical_load));
+
+    columns_.curvature.push_back(state.curvature);
+    columns_.radius.push_back(state.radius);
+    columns_.banking_angle.push_back(state.banking_angle);
+
+    columns_.timestamp.push_back(state.timestamp);
 }
 
-double LapResult::getMaxSpeed() const {
-    if (states_.empty()) return 0.0;
-    
-    double max_speed = 0.0;
-    for (const auto& state : states_) {
-        max_speed = std::max(max_speed, state.v);
+SimulationState LapResult::at(size_t index) const {
+    SimulationState state;
+
+    state.s = columns_.s[index];
+    state.n = columns_.n[index];
+    state.x = columns_.x[index];
+    state.y = columns_.y[index];
+    state.z = columns_.z[index];
+
+    state.v = columns_.v[index];
+    state.v_kmh = columns_.v_kmh[index];
+    state.ax = columns_.ax[index];
+    state.ay = columns_.ay[index];
+    state.az = columns_.az[index];
+
+    state.gx = columns_.gx[index];
+    state.gy = columns_.gy[index];
+    state.gz = columns_.gz[index];
+    state.g_total = columns_.g_total[index];
+
+    state.throttle = columns_.throttle[index];
+    state.brake = columns_.brake[index];
+    state.steering_angle = columns_.steering_angle[index];
+
+    state.gear = columns_.gear[index];
+    state.rpm = columns_.rpm[index];
+    state.engine_torque = columns_.engine_torque[index];
+    state.wheel_force = columns_.wheel_force[index];
+
+    state.drag_force = columns_.drag_force[index];
+    state.downforce = columns_.downforce[index];
+    state.tire_force_x = columns_.tire_force_x[index];
+    state.tire_force_y = columns_.tire_force_y[index];
+    state.vertical_load = columns_.vertical_load[index];
+
+    state.curvature = columns_.curvature[index];
+    state.radius = columns_.radius[index];
+    state.banking_angle = columns_.banking_angle[index];
+
+    state.timestamp = columns_.timestamp[index];
+
+    return state;
+}
+
+namespace {
+
+/**
+ * @brief Max-reduction over a double column
+ * Four AVX2 accumulators (vmaxpd has multi-cycle latency but
+ * single-cycle throughput, so independent chains keep the port busy);
+ * in-register horizontal reduce, scalar tail
+ */
+double maxReduce(const double* p, size_t n) {
+    double result = 0.0;
+#if defined(__AVX2__)
+    if (n >= 16) {
+        __m256d acc0 = _mm256_loadu_pd(p);
+        __m256d acc1 = _mm256_loadu_pd(p + 4);
+        __m256d acc2 = _mm256_loadu_pd(p + 8);
+        __m256d acc3 = _mm256_loadu_pd(p + 12);
+        size_t i = 16;
+        for (; i + 16 <= n; i += 16) {
+            acc0 = _mm256_max_pd(acc0, _mm256_loadu_pd(p + i));
+            acc1 = _mm256_max_pd(acc1, _mm256_loadu_pd(p + i + 4));
+            acc2 = _mm256_max_pd(acc2, _mm256_loadu_pd(p + i + 8));
+            acc3 = _mm256_max_pd(acc3, _mm256_loadu_pd(p + i + 12));
+        }
+        __m256d acc = _mm256_max_pd(_mm256_max_pd(acc0, acc1),
+                                    _mm256_max_pd(acc2, acc3));
+        // Horizontal max: fold high lane onto low, then the pair
+        __m256d swapped = _mm256_permute2f128_pd(acc, acc, 1);
+        acc = _mm256_max_pd(acc, swapped);
+        acc = _mm256_max_pd(acc, _mm256_permute_pd(acc, 0x5));
+        result = _mm256_cvtsd_f64(acc);
+        for (; i < n; ++i) {
+            result = std::max(result, p[i]);
+        }
+        return std::max(result, 0.0);
     }
-    return max_speed;
+#endif
+    for (size_t i = 0; i < n; ++i) {
+        result = std::max(result, p[i]);
+    }
+    return result;
+}
+
+} // namespace
+
+double LapResult::getMaxSpeed() const {
+    return maxReduce(columns_.v.data(), columns_.v.size());
 }
 
 double LapResult::getAverageSpeed() const {
-    if (states_.empty() || lap_time_ <= 0.0) return 0.0;
-    
+    if (columns_.s.empty() || lap_time_ <= 0.0) return 0.0;
+
     // Assuming states represent equal distance segments
     // Average speed = Total distance / Total time
     // For a lap, we can estimate from the last state's arc length
-    if (!states_.empty()) {
-        double total_distance = states_.back().s;
-        return total_distance / lap_time_;
-    }
-    
-    return 0.0;
+    double total_distance = columns_.s.back();
+    return total_distance / lap_time_;
 }
 
 void LapResult::getMaxGForces(double& max_gx, double& max_gy, double& max_g_total) const {
-    max_gx = 0.0;
-    max_gy = 0.0;
-    max_g_total = 0.0;
-    
-    for (const auto& state : states_) {
-        max_gx = std::max(max_gx, std::abs(state.gx));
-        max_gy = std::max(max_gy, std::abs(state.gy));
-        max_g_total = std::max(max_g_total, state.g_total);
+    const float* gx = columns_.gx.data();
+    const float* gy = columns_.gy.data();
+    const float* gt = columns_.g_total.data();
+    size_t n = columns_.gx.size();
+
+    float mx = 0.0f, my = 0.0f, mt = 0.0f;
+    size_t i = 0;
+
+#if defined(__AVX2__)
+    // Single fused pass: all three float streams are cache-hot, so the
+    // loop is bandwidth-bound and fusing beats three separate sweeps.
+    // |x| via sign-bit mask, 8 float lanes per accumulator.
+    if (n >= 8) {
+        const __m256 abs_mask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF));
+        __m256 acc_x = _mm256_setzero_ps();
+        __m256 acc_y = _mm256_setzero_ps();
+        __m256 acc_t = _mm256_setzero_ps();
+        for (; i + 8 <= n; i += 8) {
+            acc_x = _mm256_max_ps(acc_x, _mm256_and_ps(abs_mask, _mm256_loadu_ps(gx + i)));
+            acc_y = _mm256_max_ps(acc_y, _mm256_and_ps(abs_mask, _mm256_loadu_ps(gy + i)));
+            acc_t = _mm256_max_ps(acc_t, _mm256_loadu_ps(gt + i));
+        }
+        float lanes[8];
+        _mm256_storeu_ps(lanes, acc_x);
+        for (float lane : lanes) mx = std::max(mx, lane);
+        _mm256_storeu_ps(lanes, acc_y);
+        for (float lane : lanes) my = std::max(my, lane);
+        _mm256_storeu_ps(lanes, acc_t);
+        for (float lane : lanes) mt = std::max(mt, lane);
     }
+#endif
+
+    for (; i < n; ++i) {
+        mx = std::max(mx, std::abs(gx[i]));
+        my = std::max(my, std::abs(gy[i]));
+        mt = std::max(mt, gt[i]);
+    }
+
+    max_gx = mx;
+    max_gy = my;
+    max_g_total = mt;
 }
 
 void LapResult::clear() {
-    states_.clear();
+    columns_ = LapResultColumns();
     lap_time_ = 0.0;
 }
 
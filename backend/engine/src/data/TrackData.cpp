@@ -3,131 +3,234 @@
 #include <stdexcept>
 #include <cmath>
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
 namespace LapTimeSim {
 
-TrackData::TrackData() 
-    : total_length_(0.0), preprocessed_(false), track_name_("Unnamed Track") {
+TrackData::TrackData()
+    : total_length_(0.0), inv_total_length_(0.0), preprocessed_(false),
+      track_name_("Unnamed Track"), last_index_hint_(0) {
+}
+
+void TrackData::reserve(size_t n) {
+    columns_.x.reserve(n);
+    columns_.y.reserve(n);
+    columns_.z.reserve(n);
+    columns_.w_tr_left.reserve(n);
+    columns_.w_tr_right.reserve(n);
+    columns_.banking.reserve(n);
+    columns_.s.reserve(n);
+    columns_.psi.reserve(n);
+    columns_.kappa.reserve(n);
+    columns_.ds.reserve(n);
 }
 
-void TrackData::addPoint(double x, double y, double z, 
-                         double w_left, double w_right, 
+void TrackData::addPoint(double x, double y, double z,
+                         double w_left, double w_right,
                          double banking) {
-    TrackPoint point;
-    point.x = x;
-    point.y = y;
-    point.z = z;
-    point.w_tr_left = w_left;
-    point.w_tr_right = w_right;
-    point.banking = banking;
-    
-    points_.push_back(point);
+    columns_.x.push_back(x);
+    columns_.y.push_back(y);
+    columns_.z.push_back(z);
+    columns_.w_tr_left.push_back(w_left);
+    columns_.w_tr_right.push_back(w_right);
+    columns_.banking.push_back(banking);
+    columns_.s.push_back(0.0);
+    columns_.psi.push_back(0.0);
+    columns_.kappa.push_back(0.0);
+    columns_.ds.push_back(0.0);
+
     preprocessed_ = false;  // Mark as needing preprocessing
 }
 
 void TrackData::preprocess() {
-    if (points_.size() < 3) {
+    if (getNumPoints() < 3) {
         throw std::runtime_error("Track must have at least 3 points for preprocessing");
     }
-    
+
     calculateArcLength();
     calculateHeading();
     calculateCurvature();
-    
+
     preprocessed_ = true;
 }
 
 void TrackData::calculateArcLength() {
-    points_[0].s = 0.0;
-    
-    for (size_t i = 1; i < points_.size(); ++i) {
-        double dx = points_[i].x - points_[i-1].x;
-        double dy = points_[i].y - points_[i-1].y;
-        double dz = points_[i].z - points_[i-1].z;
-        
-        double segment_length = std::sqrt(dx*dx + dy*dy + dz*dz);
-        points_[i-1].ds = segment_length;
-        points_[i].s = points_[i-1].s + segment_length;
-    }
-    
+    size_t n = getNumPoints();
+    const double* x = columns_.x.data();
+    const double* y = columns_.y.data();
+    const double* z = columns_.z.data();
+    double* ds = columns_.ds.data();
+
+    // Phase 1: segment lengths. Pure data-parallel sqrt(dx²+dy²+dz²)
+    // over contiguous columns - no loop-carried dependency.
+#if defined(__AVX2__)
+    // 4 segments per iteration: unaligned loads at i and i-1 give the
+    // deltas directly from the contiguous columns
+    size_t i = 1;
+    for (; i + 4 <= n; i += 4) {
+        __m256d dx = _mm256_sub_pd(_mm256_loadu_pd(x + i), _mm256_loadu_pd(x + i - 1));
+        __m256d dy = _mm256_sub_pd(_mm256_loadu_pd(y + i), _mm256_loadu_pd(y + i - 1));
+        __m256d dz = _mm256_sub_pd(_mm256_loadu_pd(z + i), _mm256_loadu_pd(z + i - 1));
+        __m256d sq = _mm256_add_pd(_mm256_mul_pd(dx, dx),
+                     _mm256_add_pd(_mm256_mul_pd(dy, dy), _mm256_mul_pd(dz, dz)));
+        _mm256_storeu_pd(ds + i - 1, _mm256_sqrt_pd(sq));
+    }
+    for (; i < n; ++i) {
+        double dx = x[i] - x[i-1];
+        double dy = y[i] - y[i-1];
+        double dz = z[i] - z[i-1];
+        ds[i-1] = std::sqrt(dx*dx + dy*dy + dz*dz);
+    }
+#else
+    for (size_t i = 1; i < n; ++i) {
+        double dx = x[i] - x[i-1];
+        double dy = y[i] - y[i-1];
+        double dz = z[i] - z[i-1];
+        ds[i-1] = std::sqrt(dx*dx + dy*dy + dz*dz);
+    }
+#endif
+
     // Close the loop: last point connects to first
-    double dx = points_[0].x - points_.back().x;
-    double dy = points_[0].y - points_.back().y;
-    double dz = points_[0].z - points_.back().z;
-    points_.back().ds = std::sqrt(dx*dx + dy*dy + dz*dz);
-    
-    total_length_ = points_.back().s + points_.back().ds;
+    double dx = x[0] - x[n-1];
+    double dy = y[0] - y[n-1];
+    double dz = z[0] - z[n-1];
+    ds[n-1] = std::sqrt(dx*dx + dy*dy + dz*dz);
+
+    // Phase 2: prefix-sum the arc length (inherently serial, but cheap)
+    columns_.s[0] = 0.0;
+    for (size_t i = 1; i < n; ++i) {
+        columns_.s[i] = columns_.s[i-1] + ds[i-1];
+    }
+
+    total_length_ = columns_.s[n-1] + ds[n-1];
+    inv_total_length_ = 1.0 / total_length_;
 }
 
 void TrackData::calculateHeading() {
-    size_t n = points_.size();
-    
-    for (size_t i = 0; i < n; ++i) {
-        // Use central difference for better accuracy
-        size_t i_prev = (i == 0) ? (n - 1) : (i - 1);
-        size_t i_next = (i == n - 1) ? 0 : (i + 1);
-        
-        double dx = points_[i_next].x - points_[i_prev].x;
-        double dy = points_[i_next].y - points_[i_prev].y;
-        
-        points_[i].psi = std::atan2(dy, dx);
+    size_t n = getNumPoints();
+    const double* x = columns_.x.data();
+    const double* y = columns_.y.data();
+    double* psi = columns_.psi.data();
+
+    // Central differences. The interior loop uses direct i-1/i+1
+    // indexing - no per-iteration wraparound ternaries - so the only
+    // cost left is the atan2 itself; the two wrapped endpoints are
+    // peeled out of the loop. Iterations are independent, and atan2 is
+    // expensive enough that threading pays off on large tracks.
+#pragma omp parallel for schedule(static) if (n > 4096)
+    for (size_t i = 1; i < n - 1; ++i) {
+        psi[i] = std::atan2(y[i+1] - y[i-1], x[i+1] - x[i-1]);
     }
+    psi[0] = std::atan2(y[1] - y[n-1], x[1] - x[n-1]);
+    psi[n-1] = std::atan2(y[0] - y[n-2], x[0] - x[n-2]);
 }
 
 void TrackData::calculateCurvature() {
-    size_t n = points_.size();
-    
-    for (size_t i = 0; i < n; ++i) {
-        size_t i_prev = (i == 0) ? (n - 1) : (i - 1);
-        size_t i_next = (i == n - 1) ? 0 : (i + 1);
-        
-        // Calculate change in heading angle
-        double dpsi = normalizeAngle(points_[i_next].psi - points_[i_prev].psi);
-        
-        // Calculate arc length difference
-        double ds = points_[i_next].s - points_[i_prev].s;
-        if (ds < 0) {
-            ds += total_length_;  // Handle wraparound at track start/end
-        }
-        
-        // Curvature = dψ/ds
-        points_[i].kappa = (ds > 1e-6) ? (dpsi / ds) : 0.0;
+    size_t n = getNumPoints();
+    const double* s = columns_.s.data();
+    const double* psi = columns_.psi.data();
+    double* kappa = columns_.kappa.data();
+
+    // Interior: straight-line indexing, ds always positive, so the
+    // whole loop body is arithmetic plus the angle normalization.
+    // Independent iterations - same threading cutoff as the headings.
+#pragma omp parallel for schedule(static) if (n > 4096)
+    for (size_t i = 1; i < n - 1; ++i) {
+        double dpsi = normalizeAngle(psi[i+1] - psi[i-1]);
+        double ds = s[i+1] - s[i-1];
+        kappa[i] = (ds > 1e-6) ? (dpsi / ds) : 0.0;
     }
-}
 
-double TrackData::normalizeAngle(double angle) {
-    const double PI = 3.14159265358979323846;
-    while (angle > PI) angle -= 2.0 * PI;
-    while (angle < -PI) angle += 2.0 * PI;
-    return angle;
+    // Wrapped endpoints: arc-length difference crosses the start line
+    {
+        double dpsi = normalizeAngle(psi[1] - psi[n-1]);
+        double ds = s[1] - s[n-1] + total_length_;
+        kappa[0] = (ds > 1e-6) ? (dpsi / ds) : 0.0;
+    }
+    {
+        double dpsi = normalizeAngle(psi[0] - psi[n-2]);
+        double ds = s[0] - s[n-2] + total_length_;
+        kappa[n-1] = (ds > 1e-6) ? (dpsi / ds) : 0.0;
+    }
 }
 
-const TrackPoint& TrackData::getPoint(size_t index) const {
-    if (index >= points_.size()) {
+TrackPoint TrackData::getPoint(size_t index) const {
+    if (index >= getNumPoints()) {
         throw std::out_of_range("Track point index out of range");
     }
-    return points_[index];
+
+    TrackPoint point;
+    point.x = columns_.x[index];
+    point.y = columns_.y[index];
+    point.z = columns_.z[index];
+    point.w_tr_left = columns_.w_tr_left[index];
+    point.w_tr_right = columns_.w_tr_right[index];
+    point.banking = columns_.banking[index];
+    point.s = columns_.s[index];
+    point.psi = columns_.psi[index];
+    point.kappa = columns_.kappa[index];
+    point.ds = columns_.ds[index];
+    return point;
 }
 
 TrackPoint TrackData::interpolateAt(double s) const {
     if (!preprocessed_) {
         throw std::runtime_error("Track must be preprocessed before interpolation");
     }
-    
-    // Normalize s to be within track length
-    while (s < 0) s += total_length_;
-    while (s >= total_length_) s -= total_length_;
-    
-    // Find the two points to interpolate between
-    size_t i = findIndexAt(s);
-    size_t i_next = (i + 1) % points_.size();
-    
-    const TrackPoint& p1 = points_[i];
-    const TrackPoint& p2 = points_[i_next];
-    
+
+    s = normalizeS(s);
+    return interpolateSegment(s, findIndexAt(s));
+}
+
+TrackPoint TrackData::interpolateAtUnchecked(double s) const {
+    // Caller guarantees 0 <= s < total_length_ (e.g. sweeping the
+    // track's own arc-length values); skip normalization entirely
+    return interpolateSegment(s, findIndexAt(s));
+}
+
+TrackPoint TrackData::interpolateAtCursor(double s, size_t& hint) const {
+    if (!preprocessed_) {
+        throw std::runtime_error("Track must be preprocessed before interpolation");
+    }
+
+    s = normalizeS(s);
+
+    size_t n = getNumPoints();
+    const double* s_col = columns_.s.data();
+
+    // Caller-owned cursor: a sweep with monotonically increasing s hits
+    // the current or next segment almost every time, making the whole
+    // sweep O(N) instead of O(N log N)
+    size_t i = hint;
+    if (i < n && s_col[i] <= s) {
+        int steps = 0;
+        while (i + 1 < n && s_col[i + 1] <= s && steps < 4) {
+            ++i;
+            ++steps;
+        }
+        if (i + 1 >= n || s_col[i + 1] > s) {
+            hint = i;
+            return interpolateSegment(s, i);
+        }
+    }
+
+    // Cursor missed (reset, lap wrap, or long jump): full search
+    hint = findIndexAt(s);
+    return interpolateSegment(s, hint);
+}
+
+TrackPoint TrackData::interpolateSegment(double s, size_t i) const {
+    size_t i_next = (i + 1) % getNumPoints();
+
+    TrackPoint p1 = getPoint(i);
+    TrackPoint p2 = getPoint(i_next);
+
     // Linear interpolation parameter
     double t = (p1.ds > 1e-6) ? ((s - p1.s) / p1.ds) : 0.0;
     t = std::max(0.0, std::min(1.0, t));  // Clamp to [0, 1]
-    
+
     TrackPoint result;
     result.x = p1.x + t * (p2.x - p1.x);
     result.y = p1.y + t * (p2.y - p1.y);
@@ -136,14 +239,14 @@ TrackPoint TrackData::interpolateAt(double s) const {
     result.w_tr_left = p1.w_tr_left + t * (p2.w_tr_left - p1.w_tr_left);
     result.w_tr_right = p1.w_tr_right + t * (p2.w_tr_right - p1.w_tr_right);
     result.banking = p1.banking + t * (p2.banking - p1.banking);
-    
+
     // For heading, need to handle angle wraparound
     double dpsi = normalizeAngle(p2.psi - p1.psi);
     result.psi = normalizeAngle(p1.psi + t * dpsi);
-    
+
     result.kappa = p1.kappa + t * (p2.kappa - p1.kappa);
     result.ds = p1.ds;
-    
+
     return result;
 }
 
@@ -151,57 +254,107 @@ double TrackData::getCurvatureAt(double s) const {
     if (!preprocessed_) {
         throw std::runtime_error("Track must be preprocessed before querying curvature");
     }
-    
-    // Normalize s
-    while (s < 0) s += total_length_;
-    while (s >= total_length_) s -= total_length_;
-    
+
+    s = normalizeS(s);
+
     size_t i = findIndexAt(s);
-    size_t i_next = (i + 1) % points_.size();
-    
-    const TrackPoint& p1 = points_[i];
-    const TrackPoint& p2 = points_[i_next];
-    
-    double t = (p1.ds > 1e-6) ? ((s - p1.s) / p1.ds) : 0.0;
+    size_t i_next = (i + 1) % getNumPoints();
+
+    // Only the s/ds/kappa columns are needed here - no full gather
+    double s1 = columns_.s[i];
+    double ds1 = columns_.ds[i];
+    double k1 = columns_.kappa[i];
+    double k2 = columns_.kappa[i_next];
+
+    double t = (ds1 > 1e-6) ? ((s - s1) / ds1) : 0.0;
+    t = std::max(0.0, std::min(1.0, t));
+
+    return k1 + t * (k2 - k1);
+}
+
+double TrackData::getBankingAt(double s) const {
+    if (!preprocessed_) {
+        throw std::runtime_error("Track must be preprocessed before querying banking");
+    }
+
+    s = normalizeS(s);
+
+    size_t i = findIndexAt(s);
+    size_t i_next = (i + 1) % getNumPoints();
+
+    double t = (columns_.ds[i] > 1e-6) ? ((s - columns_.s[i]) / columns_.ds[i]) : 0.0;
+    t = std::max(0.0, std::min(1.0, t));
+
+    return columns_.banking[i] + t * (columns_.banking[i_next] - columns_.banking[i]);
+}
+
+TrackLocalGeometry TrackData::getLocalGeometryAt(double s) const {
+    if (!preprocessed_) {
+        throw std::runtime_error("Track must be preprocessed before querying geometry");
+    }
+
+    s = normalizeS(s);
+
+    size_t i = findIndexAt(s);
+    size_t i_next = (i + 1) % getNumPoints();
+
+    double t = (columns_.ds[i] > 1e-6) ? ((s - columns_.s[i]) / columns_.ds[i]) : 0.0;
     t = std::max(0.0, std::min(1.0, t));
-    
-    return p1.kappa + t * (p2.kappa - p1.kappa);
+
+    TrackLocalGeometry geom;
+    geom.kappa = columns_.kappa[i] + t * (columns_.kappa[i_next] - columns_.kappa[i]);
+
+    double dpsi = normalizeAngle(columns_.psi[i_next] - columns_.psi[i]);
+    geom.psi = normalizeAngle(columns_.psi[i] + t * dpsi);
+
+    geom.banking = columns_.banking[i] + t * (columns_.banking[i_next] - columns_.banking[i]);
+    return geom;
 }
 
 bool TrackData::isWithinBounds(double s, double n) const {
     if (!preprocessed_) {
         throw std::runtime_error("Track must be preprocessed before boundary checking");
     }
-    
+
     TrackPoint point = interpolateAt(s);
-    
+
     // n > 0 means left of centerline
     // n < 0 means right of centerline
     return (n >= -point.w_tr_right && n <= point.w_tr_left);
 }
 
 size_t TrackData::findIndexAt(double s) const {
-    // Binary search for efficiency
-    size_t left = 0;
-    size_t right = points_.size() - 1;
-    
-    while (left < right) {
-        size_t mid = left + (right - left) / 2;
-        
-        if (points_[mid].s <= s) {
-            left = mid + 1;
-        } else {
-            right = mid;
+    size_t n = getNumPoints();
+    const double* s_col = columns_.s.data();
+
+    // Fast path: successive queries are usually monotonically increasing,
+    // so check the last hit and walk forward a few segments before
+    // falling back to the binary search
+    size_t hint = last_index_hint_;
+    if (hint < n && s_col[hint] <= s) {
+        for (int step = 0; step < 4; ++step) {
+            if (hint + 1 >= n || s_col[hint + 1] > s) {
+                last_index_hint_ = hint;
+                return hint;
+            }
+            ++hint;
         }
     }
-    
-    // Return the index of the point at or just before s
-    if (left > 0 && points_[left].s > s) {
-        return left - 1;
+
+    // Branchless binary search for the last index with s_col[i] <= s:
+    // the comparison feeds a conditional move instead of a jump, so a
+    // mispredict-prone branch never enters the pipeline
+    size_t base = 0;
+    size_t len = n;
+    while (len > 1) {
+        size_t half = len / 2;
+        base += (s_col[base + half] <= s) ? half : 0;
+        len -= half;
     }
-    return left;
+
+    last_index_hint_ = base;
+    return base;
 }
 
 } // namespace LapTimeSim
 
-
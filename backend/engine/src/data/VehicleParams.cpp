@@ -16,21 +16,24 @@ double PowertrainParams::getTorqueAt(double rpm) const {
     
     // Clamp RPM to valid range
     rpm = std::max(0.0, rpm);
-    
+
     // If RPM is below or at the first data point
-    if (rpm <= engine_torque_curve.begin()->first) {
-        return engine_torque_curve.begin()->second;
+    if (rpm <= engine_torque_curve.front().first) {
+        return engine_torque_curve.front().second;
     }
-    
+
     // If RPM is above or at the last data point
-    if (rpm >= engine_torque_curve.rbegin()->first) {
-        return engine_torque_curve.rbegin()->second;
+    if (rpm >= engine_torque_curve.back().first) {
+        return engine_torque_curve.back().second;
     }
-    
-    // Find the two points to interpolate between
-    auto upper = engine_torque_curve.upper_bound(rpm);
+
+    // Binary search over the sorted, contiguous curve
+    auto upper = std::lower_bound(engine_torque_curve.begin(), engine_torque_curve.end(), rpm,
+                                  [](const std::pair<double, double>& sample, double value) {
+                                      return sample.first < value;
+                                  });
     auto lower = std::prev(upper);
-    
+
     // Linear interpolation
     double rpm1 = lower->first;
     double torque1 = lower->second;
@@ -41,37 +44,56 @@ double PowertrainParams::getTorqueAt(double rpm) const {
     return torque1 + t * (torque2 - torque1);
 }
 
-int PowertrainParams::getOptimalGear(double velocity, double tire_radius, double target_rpm) const {
+double PowertrainParams::getMaxEnginePower() const {
+    if (cached_max_power_ < 0.0) {
+        const double PI = 3.14159265358979323846;
+        double max_power = 0.0;
+
+        for (const auto& [rpm, torque] : engine_torque_curve) {
+            // Power (W) = Torque (Nm) × Angular Velocity (rad/s)
+            double power_watts = torque * (rpm * 2.0 * PI / 60.0);
+            max_power = std::max(max_power, power_watts);
+        }
+
+        cached_max_power_ = max_power;
+    }
+
+    return cached_max_power_;
+}
+
+int PowertrainParams::getOptimalGear(double velocity, double tire_radius, double /*target_rpm*/) const {
     if (gear_ratios.empty() || tire_radius <= 0.0 || velocity <= 0.1) {
         return 1;
     }
     
-    const double PI = 3.14159265358979323846;
-    
     // Target RPM range: 70-90% of max RPM for best power/efficiency balance
     double optimal_rpm_low = max_rpm * 0.70;   // 10,500 RPM for F1
-    double optimal_rpm_high = max_rpm * 0.90;  // 13,500 RPM for F1
-    
-    // Find highest gear that keeps RPM above optimal_rpm_low
-    for (int i = static_cast<int>(gear_ratios.size()) - 1; i >= 0; --i) {
-        double rpm = (velocity / tire_radius) * gear_ratios[i] * final_drive_ratio * 60.0 / (2.0 * PI);
-        
-        // Use this gear if:
-        // 1. RPM is in valid operating range
-        // 2. RPM is above 70% of max (good power band)
-        if (rpm >= min_rpm && rpm <= max_rpm && rpm >= optimal_rpm_low) {
-            return i + 1;  // Gears are 1-indexed
-        }
+
+    // The gear-independent coefficient carries the only divide; cache
+    // it keyed on the tire radius so repeated calls during a solve pay
+    // one multiply each. rpm = velocity * k * gear_ratios[i]
+    if (tire_radius != cached_rpm_coef_radius_) {
+        const double PI = 3.14159265358979323846;
+        cached_rpm_coef_ = 60.0 * final_drive_ratio / (2.0 * PI * tire_radius);
+        cached_rpm_coef_radius_ = tire_radius;
     }
-    
-    // Fallback: find any gear that keeps RPM in valid range
-    for (size_t i = 0; i < gear_ratios.size(); ++i) {
-        double rpm = (velocity / tire_radius) * gear_ratios[i] * final_drive_ratio * 60.0 / (2.0 * PI);
-        if (rpm >= min_rpm && rpm <= max_rpm) {
-            return static_cast<int>(i + 1);
-        }
+    double k = velocity * cached_rpm_coef_;
+
+    // Single ascending pass, branchless selects (cmov-friendly):
+    // band_best keeps the highest gear in the power band, valid_first
+    // the lowest gear merely in the operating range (the old fallback)
+    int band_best = 0;
+    int valid_first = 0;
+    int n_gears = static_cast<int>(gear_ratios.size());
+    for (int i = 0; i < n_gears; ++i) {
+        double rpm = k * gear_ratios[i];
+        bool in_range = (rpm >= min_rpm) && (rpm <= max_rpm);
+        band_best = (in_range && rpm >= optimal_rpm_low) ? (i + 1) : band_best;
+        valid_first = (in_range && valid_first == 0) ? (i + 1) : valid_first;
     }
-    
+
+    if (band_best != 0) return band_best;
+    if (valid_first != 0) return valid_first;
     return 1;  // Default to first gear
 }
 
@@ -106,20 +128,9 @@ bool VehicleParams::validate() const {
 
 double VehicleParams::getPowerToWeightRatio() const {
     if (powertrain.engine_torque_curve.empty()) return 0.0;
-    
-    // Find maximum power in the torque curve
-    double max_power = 0.0;
-    const double PI = 3.14159265358979323846;
-    
-    for (const auto& [rpm, torque] : powertrain.engine_torque_curve) {
-        // Power (W) = Torque (Nm) × Angular Velocity (rad/s)
-        // Angular Velocity = RPM × 2π / 60
-        double power_watts = torque * (rpm * 2.0 * PI / 60.0);
-        max_power = std::max(max_power, power_watts);
-    }
-    
-    // Convert to horsepower and calculate ratio
-    double max_hp = max_power / 745.7;  // 1 hp = 745.7 watts
+
+    // Convert cached peak power to horsepower and calculate ratio
+    double max_hp = powertrain.getMaxEnginePower() / 745.7;  // 1 hp = 745.7 watts
     return max_hp / mass.mass;
 }
 
@@ -127,16 +138,8 @@ double VehicleParams::getMaxTheoreticalSpeed() const {
     // At maximum speed, all engine power is used to overcome drag
     // Power = Drag Force × Velocity
     // 0.5 × ρ × v³ × Cd × A = Power
-    
-    // Find maximum power
-    double max_power = 0.0;
-    const double PI = 3.14159265358979323846;
-    
-    for (const auto& [rpm, torque] : powertrain.engine_torque_curve) {
-        double power_watts = torque * (rpm * 2.0 * PI / 60.0) * powertrain.drivetrain_efficiency;
-        max_power = std::max(max_power, power_watts);
-    }
-    
+    double max_power = powertrain.getMaxEnginePower() * powertrain.drivetrain_efficiency;
+
     // Solve for velocity: v = (2 × Power / (ρ × Cd × A))^(1/3)
     double v_cubed = (2.0 * max_power) / (aero.air_density * aero.Cd * aero.frontal_area);
     return std::pow(v_cubed, 1.0 / 3.0);
@@ -1,53 +1,66 @@
 #include "io/JSONParser.h"
+#include <json/json.h>
+#include <algorithm>
+#include <charconv>
+#include <cstring>
 #include <fstream>
 #include <sstream>
 #include <stdexcept>
 #include <iostream>
+#include <memory>
 #include <vector>
 
 namespace LapTimeSim {
 
-Json::Value JSONParser::readJSONFile(const std::string& filepath) {
+// Load-time helpers. File-scope rather than class members so jsoncpp
+// stays out of the public header (every TU including JSONParser.h used
+// to pull in <json/json.h>) and the linker can drop what main doesn't
+// reach.
+namespace {
+
+Json::Value readJSONFile(const std::string& filepath) {
     std::ifstream file(filepath, std::ifstream::binary);
     if (!file.is_open()) {
         throw std::runtime_error("Could not open file: " + filepath);
     }
-    
-    Json::Value root;
+
+    // Slurp the whole file and parse from the contiguous buffer.
+    // parseFromStream pulls characters through the istream layer one
+    // buffer at a time; CharReader over a single in-memory block avoids
+    // that indirection, and skipping comment collection drops the
+    // per-node comment strings the DOM would otherwise allocate.
+    file.seekg(0, std::ios::end);
+    std::string buffer(static_cast<size_t>(file.tellg()), '\0');
+    file.seekg(0, std::ios::beg);
+    file.read(&buffer[0], static_cast<std::streamsize>(buffer.size()));
+
     Json::CharReaderBuilder builder;
+    builder["collectComments"] = false;
+    std::unique_ptr<Json::CharReader> reader(builder.newCharReader());
+
+    Json::Value root;
     std::string errors;
-    
-    if (!Json::parseFromStream(builder, file, &root, &errors)) {
+    if (!reader->parse(buffer.data(), buffer.data() + buffer.size(), &root, &errors)) {
         throw std::runtime_error("Failed to parse JSON file: " + errors);
     }
-    
-    return root;
-}
 
-double JSONParser::getDouble(const Json::Value& value, const std::string& key, double default_val) {
-    if (value.isMember(key)) {
-        return value[key].asDouble();
-    }
-    return default_val;
+    return root;
 }
 
-int JSONParser::getInt(const Json::Value& value, const std::string& key, int default_val) {
-    if (value.isMember(key)) {
-        return value[key].asInt();
+double getDouble(const Json::Value& value, const std::string& key, double default_val) {
+    // find() does one map lookup; isMember + operator[] would do two.
+    // Noticeable on track files where every point is six keyed reads.
+    const Json::Value* member = value.find(key.data(), key.data() + key.size());
+    if (member != nullptr) {
+        return member->asDouble();
     }
     return default_val;
 }
 
-std::string JSONParser::getString(const Json::Value& value, const std::string& key, 
-                                  const std::string& default_val) {
-    if (value.isMember(key)) {
-        return value[key].asString();
-    }
-    return default_val;
-}
+} // namespace
 
 TrackData JSONParser::parseTrackJSON(const std::string& filepath) {
-    std::cout << "Parsing track JSON: " << filepath << std::endl;
+    std::cout << "Parsing track JSON: " << filepath << '\n';
     
     Json::Value root = readJSONFile(filepath);
     TrackData track;
@@ -66,7 +79,9 @@ TrackData JSONParser::parseTrackJSON(const std::string& filepath) {
     if (!points.isArray()) {
         throw std::runtime_error("'points' must be an array");
     }
-    
+
+    track.reserve(points.size());
+
     for (const auto& point : points) {
         double x = getDouble(point, "x", 0.0);
         double y = getDouble(point, "y", 0.0);
@@ -79,15 +94,15 @@ TrackData JSONParser::parseTrackJSON(const std::string& filepath) {
     }
     
     // Preprocess the track
-    std::cout << "Preprocessing track with " << track.getNumPoints() << " points..." << std::endl;
+    std::cout << "Preprocessing track with " << track.getNumPoints() << " points..." << '\n';
     track.preprocess();
-    std::cout << "Track preprocessed. Total length: " << track.getTotalLength() << " m" << std::endl;
+    std::cout << "Track preprocessed. Total length: " << track.getTotalLength() << " m" << '\n';
     
     return track;
 }
 
 TrackData JSONParser::parseTrackCSV(const std::string& filepath) {
-    std::cout << "Parsing TUMFTM CSV track: " << filepath << std::endl;
+    std::cout << "Parsing TUMFTM CSV track: " << filepath << '\n';
     
     std::ifstream file(filepath);
     if (!file.is_open()) {
@@ -109,55 +124,79 @@ TrackData JSONParser::parseTrackCSV(const std::string& filepath) {
     
     track.setName(track_name);
     
-    std::string line;
-    // Skip header line (starts with #)
-    while (std::getline(file, line)) {
-        if (!line.empty() && line[0] != '#') {
-            // Put it back for processing
-            file.seekg(-(line.length() + 1), std::ios_base::cur);
-            break;
-        }
-    }
-    
+    // Slurp the whole file and tokenize in place. std::from_chars is
+    // locale-independent and avoids the per-token std::string and
+    // stringstream allocations of the getline/stod approach.
+    file.seekg(0, std::ios::end);
+    std::string buffer(static_cast<size_t>(file.tellg()), '\0');
+    file.seekg(0, std::ios::beg);
+    file.read(&buffer[0], static_cast<std::streamsize>(buffer.size()));
+
+    // Newline count bounds the point count; reserving up front keeps
+    // the column vectors from reallocating during the fill loop
+    size_t line_count = static_cast<size_t>(
+        std::count(buffer.begin(), buffer.end(), '\n')) + 1;
+    track.reserve(line_count);
+
     int point_count = 0;
-    while (std::getline(file, line)) {
+    const char* p = buffer.data();
+    const char* file_end = p + buffer.size();
+
+    while (p < file_end) {
+        const char* nl = static_cast<const char*>(
+            std::memchr(p, '\n', static_cast<size_t>(file_end - p)));
+        const char* line_end = nl ? nl : file_end;
+
         // Skip empty lines or comments
-        if (line.empty() || line[0] == '#') continue;
-        
-        std::stringstream ss(line);
-        std::string token;
-        std::vector<double> values;
-        
+        if (p == line_end || *p == '#') {
+            p = line_end + 1;
+            continue;
+        }
+
         // Parse comma-separated values
-        while (std::getline(ss, token, ',')) {
-            try {
-                values.push_back(std::stod(token));
-            } catch (...) {
-                continue;
+        double values[8];
+        size_t n_values = 0;
+        const char* field = p;
+        while (field < line_end && n_values < 8) {
+            const char* comma = static_cast<const char*>(
+                std::memchr(field, ',', static_cast<size_t>(line_end - field)));
+            const char* field_end = comma ? comma : line_end;
+
+            // Tolerate leading whitespace; skip fields that fail to parse
+            while (field < field_end && (*field == ' ' || *field == '\t')) ++field;
+            double value;
+            auto [ptr, ec] = std::from_chars(field, field_end, value);
+            if (ec == std::errc()) {
+                values[n_values++] = value;
             }
+
+            if (!comma) break;
+            field = comma + 1;
         }
-        
-        if (values.size() >= 4) {
+
+        if (n_values >= 4) {
             // TUMFTM format: x_m, y_m, w_tr_right_m, w_tr_left_m
             track.addPoint(values[0], values[1], 0.0, values[3], values[2], 0.0);
             point_count++;
         }
+
+        p = line_end + 1;
     }
     
     if (track.getNumPoints() == 0) {
         throw std::runtime_error("No valid track points found in CSV");
     }
     
-    std::cout << "Loaded " << point_count << " points from CSV" << std::endl;
-    std::cout << "Preprocessing track..." << std::endl;
+    std::cout << "Loaded " << point_count << " points from CSV" << '\n';
+    std::cout << "Preprocessing track..." << '\n';
     track.preprocess();
-    std::cout << "Track preprocessed. Total length: " << track.getTotalLength() << " m" << std::endl;
+    std::cout << "Track preprocessed. Total length: " << track.getTotalLength() << " m" << '\n';
     
     return track;
 }
 
 VehicleParams JSONParser::parseVehicleJSON(const std::string& filepath) {
-    std::cout << "Parsing vehicle JSON: " << filepath << std::endl;
+    std::cout << "Parsing vehicle JSON: " << filepath << '\n';
     
     Json::Value root = readJSONFile(filepath);
     VehicleParams vehicle;
@@ -201,11 +240,21 @@ VehicleParams JSONParser::parseVehicleJSON(const std::string& filepath) {
         // Engine torque curve
         if (powertrain.isMember("engine_torque_curve")) {
             const Json::Value& curve = powertrain["engine_torque_curve"];
+            vehicle.powertrain.engine_torque_curve.reserve(curve.size());
             for (const auto& key : curve.getMemberNames()) {
-                double rpm = std::stod(key);
+                // Keys are numeric RPM strings; from_chars skips the
+                // locale machinery and cannot throw
+                double rpm = 0.0;
+                auto [ptr, ec] = std::from_chars(key.data(), key.data() + key.size(), rpm);
+                if (ec != std::errc()) {
+                    throw std::runtime_error("Invalid RPM key in engine_torque_curve: " + key);
+                }
                 double torque = curve[key].asDouble();
-                vehicle.powertrain.engine_torque_curve[rpm] = torque;
+                vehicle.powertrain.engine_torque_curve.emplace_back(rpm, torque);
             }
+            // Keep the curve sorted by RPM for binary-search lookups
+            std::sort(vehicle.powertrain.engine_torque_curve.begin(),
+                      vehicle.powertrain.engine_torque_curve.end());
         }
         
         // Gear ratios
@@ -235,12 +284,39 @@ VehicleParams JSONParser::parseVehicleJSON(const std::string& filepath) {
         throw std::runtime_error("Vehicle parameters failed validation");
     }
     
-    std::cout << "Vehicle parsed successfully: " << vehicle.getName() << std::endl;
-    std::cout << "  Mass: " << vehicle.mass.mass << " kg" << std::endl;
-    std::cout << "  Power/Weight: " << vehicle.getPowerToWeightRatio() << " hp/kg" << std::endl;
+    std::cout << "Vehicle parsed successfully: " << vehicle.getName() << '\n';
+    std::cout << "  Mass: " << vehicle.mass.mass << " kg" << '\n';
+    std::cout << "  Power/Weight: " << vehicle.getPowerToWeightRatio() << " hp/kg" << '\n';
     
     return vehicle;
 }
 
+std::vector<BatchJob> JSONParser::parseBatchManifest(const std::string& filepath) {
+    Json::Value root = readJSONFile(filepath);
+
+    if (!root.isMember("jobs") || !root["jobs"].isArray()) {
+        throw std::runtime_error("Batch manifest must contain a 'jobs' array");
+    }
+
+    const Json::Value& jobs = root["jobs"];
+    std::vector<BatchJob> result;
+    result.reserve(jobs.size());
+
+    for (const auto& job : jobs) {
+        BatchJob entry;
+        if (!job.isMember("track") || !job.isMember("vehicle")) {
+            throw std::runtime_error("Batch job must specify 'track' and 'vehicle'");
+        }
+        entry.track_file = job["track"].asString();
+        entry.vehicle_file = job["vehicle"].asString();
+        if (job.isMember("csv")) {
+            entry.csv_output = job["csv"].asString();
+        }
+        result.push_back(std::move(entry));
+    }
+
+    return result;
+}
+
 } // namespace LapTimeSim
 
@@ -15,10 +15,20 @@
 #include "io/JSONParser.h"
 #include "solver/QuasiSteadyStateSolver.h"
 #include "telemetry/TelemetryLogger.h"
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <future>
 #include <iostream>
 #include <string>
+#include <string_view>
 #include <memory>
 #include <stdexcept>
+#include <thread>
+#include <vector>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 using namespace LapTimeSim;
 
@@ -28,6 +38,8 @@ void printUsage(const char* program_name) {
     std::cout << "  --csv <file>        Export telemetry to CSV file\n";
     std::cout << "  --json <file>       Export telemetry to JSON file\n";
     std::cout << "  --ggv <file>        Export GGV diagram to CSV file\n";
+    std::cout << "  --batch <file>      Run all jobs in a JSON manifest concurrently\n";
+    std::cout << "  --jobs <N>          Worker thread cap (OpenMP teams and batch jobs)\n";
     std::cout << "  --iterations <N>    Maximum solver iterations (default: 10)\n";
     std::cout << "  --tolerance <T>     Convergence tolerance (default: 0.001)\n";
     std::cout << "  --help              Show this help message\n";
@@ -41,6 +53,8 @@ struct CommandLineArgs {
     std::string csv_output;
     std::string json_output;
     std::string ggv_output;
+    std::string batch_file;
+    int jobs = 0;               // 0 = use all hardware threads
     int max_iterations = 10;
     double tolerance = 0.001;
     bool show_help = false;
@@ -48,7 +62,18 @@ struct CommandLineArgs {
 
 CommandLineArgs parseArguments(int argc, char* argv[]) {
     CommandLineArgs args;
-    
+
+    // Batch mode replaces the positional track/vehicle pair
+    if (argc >= 3 && std::string(argv[1]) == "--batch") {
+        args.batch_file = argv[2];
+        for (int i = 3; i < argc; ++i) {
+            if (std::string(argv[i]) == "--jobs" && i + 1 < argc) {
+                args.jobs = std::stoi(argv[++i]);
+            }
+        }
+        return args;
+    }
+
     if (argc < 3) {
         args.show_help = true;
         return args;
@@ -72,23 +97,151 @@ CommandLineArgs parseArguments(int argc, char* argv[]) {
             args.max_iterations = std::stoi(argv[++i]);
         } else if (arg == "--tolerance" && i + 1 < argc) {
             args.tolerance = std::stod(argv[++i]);
+        } else if (arg == "--jobs" && i + 1 < argc) {
+            args.jobs = std::stoi(argv[++i]);
         }
     }
     
     return args;
 }
 
+// Sanitize a vehicle/track name for use in a filename. One read/write
+// pass: a 256-entry table maps each character (space, '-', '(', ')'
+// become '_'), and consecutive underscores collapse as they are
+// written - no repeated find/replace over the string.
+std::string cleanName(std::string str) {
+    static constexpr auto tbl = [] {
+        std::array<char, 256> t{};
+        for (int i = 0; i < 256; ++i) t[i] = static_cast<char>(i);
+        t[' '] = t['-'] = t['('] = t[')'] = '_';
+        return t;
+    }();
+
+    size_t out = 0;
+    bool last_underscore = false;
+    for (char c : str) {
+        char mapped = tbl[static_cast<unsigned char>(c)];
+        if (mapped == '_' && last_underscore) {
+            continue;
+        }
+        last_underscore = (mapped == '_');
+        str[out++] = mapped;
+    }
+    str.resize(out);
+    return str;
+}
+
+// Default telemetry filename: carname-track-laptime-VSIM.csv
+std::string makeCsvFilename(const std::string& vehicle_name,
+                            const std::string& track_name,
+                            double lap_time) {
+    int minutes = static_cast<int>(lap_time) / 60;
+    int seconds = static_cast<int>(lap_time) % 60;
+
+    // MM_SS via to_chars: no locale, no varargs. The minutes field is
+    // capped four bytes short of the buffer end so the separator, the
+    // zero pad, and the two-digit seconds are provably in bounds
+    // (to_chars never writes past the limit it is given).
+    char lap_str[16];
+    char* const minutes_end = lap_str + sizeof(lap_str) - 4;
+    char* p = std::to_chars(lap_str, minutes_end, minutes).ptr;
+    *p++ = '_';
+    if (seconds < 10) *p++ = '0';
+    p = std::to_chars(p, lap_str + sizeof(lap_str), seconds).ptr;
+
+    return "outputs/" + cleanName(vehicle_name) + "-" + cleanName(track_name)
+           + "-" + std::string(lap_str, p) + "-VSIM.csv";
+}
+
+TrackData loadTrack(const std::string& track_file) {
+    // Auto-detect track file format (CSV or JSON)
+    if (track_file.find(".csv") != std::string::npos) {
+        return JSONParser::parseTrackCSV(track_file);
+    }
+    return JSONParser::parseTrackJSON(track_file);
+}
+
+/**
+ * @brief Run every job of a batch manifest, fanned out across cores
+ *
+ * Jobs are independent (track, vehicle) simulations, so they dispatch
+ * via std::async with at most hardware_concurrency in flight; each job
+ * writes its own telemetry CSV. Per-job console output interleaves.
+ */
+int runBatch(const CommandLineArgs& args) {
+    std::vector<BatchJob> jobs = JSONParser::parseBatchManifest(args.batch_file);
+    std::cout << "Batch mode: " << jobs.size() << " jobs from "
+              << args.batch_file << "\n";
+
+    auto run_job = [&args](BatchJob job) {
+        TrackData track = loadTrack(job.track_file);
+        VehicleParams vehicle = JSONParser::parseVehicleJSON(job.vehicle_file);
+
+        QuasiSteadyStateSolver solver(track, vehicle);
+        // Concurrent jobs would interleave iteration logs; the batch
+        // summary table is the single source of results
+        solver.setVerbose(false);
+        double lap_time = solver.solve(args.max_iterations, args.tolerance);
+
+        LapResult result = solver.getDetailedResult();
+        std::string csv = job.csv_output.empty()
+            ? makeCsvFilename(vehicle.getName(), track.getName(), lap_time)
+            : job.csv_output;
+        TelemetryLogger logger;
+        logger.exportToCSV(result, csv);
+
+        return lap_time;
+    };
+
+    size_t max_parallel = (args.jobs > 0)
+        ? static_cast<size_t>(args.jobs)
+        : std::max(1u, std::thread::hardware_concurrency());
+    std::vector<std::future<double>> futures(jobs.size());
+    std::vector<double> lap_times(jobs.size(), 0.0);
+    size_t next_join = 0;
+
+    for (size_t i = 0; i < jobs.size(); ++i) {
+        // Keep at most max_parallel jobs in flight
+        if (i - next_join >= max_parallel) {
+            lap_times[next_join] = futures[next_join].get();
+            ++next_join;
+        }
+        futures[i] = std::async(std::launch::async, run_job, jobs[i]);
+    }
+    for (; next_join < jobs.size(); ++next_join) {
+        lap_times[next_join] = futures[next_join].get();
+    }
+
+    std::cout << "\nBatch results:\n";
+    for (size_t i = 0; i < jobs.size(); ++i) {
+        std::cout << "  [" << (i + 1) << "/" << jobs.size() << "] "
+                  << jobs[i].track_file << " + " << jobs[i].vehicle_file
+                  << " -> " << std::fixed << std::setprecision(4)
+                  << lap_times[i] << " s\n";
+    }
+
+    return 0;
+}
+
 int main(int argc, char* argv[]) {
+    // Console output is one-directional and single-threaded here, so
+    // drop the C-stdio synchronization (it adds a lock to every stream
+    // op) and untie cin before any logging happens
+    std::ios::sync_with_stdio(false);
+    std::cin.tie(nullptr);
+
     try {
-        // Banner
-        std::cout << "\n";
-        std::cout << "╔════════════════════════════════════════════════════════════════╗\n";
-        std::cout << "║                                                                ║\n";
-        std::cout << "║    High-Fidelity Lap Time Simulation Engine                   ║\n";
-        std::cout << "║    Race Line Optimization & Vehicle Dynamics                  ║\n";
-        std::cout << "║                                                                ║\n";
-        std::cout << "╚════════════════════════════════════════════════════════════════╝\n";
-        std::cout << "\n";
+        // Banner, emitted as one write
+        constexpr std::string_view banner =
+            "\n"
+            "╔════════════════════════════════════════════════════════════════╗\n"
+            "║                                                                ║\n"
+            "║    High-Fidelity Lap Time Simulation Engine                   ║\n"
+            "║    Race Line Optimization & Vehicle Dynamics                  ║\n"
+            "║                                                                ║\n"
+            "╚════════════════════════════════════════════════════════════════╝\n"
+            "\n";
+        std::cout << banner;
         
         // Parse command line arguments
         CommandLineArgs args = parseArguments(argc, argv);
@@ -97,6 +250,16 @@ int main(int argc, char* argv[]) {
             printUsage(argv[0]);
             return 0;
         }
+
+        if (args.jobs > 0) {
+#ifdef _OPENMP
+            omp_set_num_threads(args.jobs);
+#endif
+        }
+
+        if (!args.batch_file.empty()) {
+            return runBatch(args);
+        }
         
         std::cout << "Configuration:\n";
         std::cout << "  Track file: " << args.track_file << "\n";
@@ -107,13 +270,7 @@ int main(int argc, char* argv[]) {
         
         // Parse input files
         std::cout << "═══ Phase 1: Loading Data ═══\n";
-        // Auto-detect track file format (CSV or JSON)
-        TrackData track;
-        if (args.track_file.find(".csv") != std::string::npos) {
-            track = JSONParser::parseTrackCSV(args.track_file);
-        } else {
-            track = JSONParser::parseTrackJSON(args.track_file);
-        }
+        TrackData track = loadTrack(args.track_file);
         VehicleParams vehicle = JSONParser::parseVehicleJSON(args.vehicle_file);
         std::cout << "\n";
         
@@ -141,35 +298,7 @@ int main(int argc, char* argv[]) {
         // Auto-generate CSV filename if not provided
         std::string csv_filename = args.csv_output;
         if (csv_filename.empty()) {
-            // Extract names from paths
-            std::string vehicle_name = vehicle.getName();
-            std::string track_name = track.getName();
-            
-            
-            // Clean up names (remove spaces, special chars)
-            auto clean_name = [](std::string str) {
-                for (auto& c : str) {
-                    if (c == ' ' || c == '-' || c == '(' || c == ')') c = '_';
-                }
-                // Remove consecutive underscores
-                size_t pos;
-                while ((pos = str.find("__")) != std::string::npos) {
-                    str.replace(pos, 2, "_");
-                }
-                return str;
-            };
-            
-            vehicle_name = clean_name(vehicle_name);
-            track_name = clean_name(track_name);
-            
-            // Format lap time as MM_SS
-            int minutes = static_cast<int>(lap_time) / 60;
-            int seconds = static_cast<int>(lap_time) % 60;
-            char lap_str[16];
-            snprintf(lap_str, sizeof(lap_str), "%d_%02d", minutes, seconds);
-            
-            // Generate filename: carname-track-laptime-VSIM.csv
-            csv_filename = "outputs/" + vehicle_name + "-" + track_name + "-" + lap_str + "-VSIM.csv";
+            csv_filename = makeCsvFilename(vehicle.getName(), track.getName(), lap_time);
         }
         
         // Always export CSV
@@ -1,36 +1,52 @@
 #include "physics/AerodynamicsModel.h"
 #include <cmath>
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
 namespace LapTimeSim {
 
 AerodynamicsModel::AerodynamicsModel(const AeroParams& params)
     : params_(params) {
+    rebuildCoefficients();
 }
 
-double AerodynamicsModel::getDragForce(double v) const {
-    // F_drag = 0.5 × ρ × v² × Cd × A
-    double v_squared = v * v;
-    return getAeroCoefficient() * params_.Cd * v_squared;
-}
-
-double AerodynamicsModel::getDownforce(double v) const {
-    // F_lift = 0.5 × ρ × v² × Cl × A
-    // Cl is typically negative for race cars (downforce)
-    // Return positive value for downforce
-    double v_squared = v * v;
-    return -getAeroCoefficient() * params_.Cl * v_squared;
-}
-
-double AerodynamicsModel::getTotalVerticalLoad(double v, double mass, double g) const {
-    // Total vertical load = Weight + Downforce
-    double weight = mass * g;
-    double downforce = getDownforce(v);
-    return weight + downforce;
+void AerodynamicsModel::getDragForceBatch(const double* v, double* out, size_t n) const noexcept {
+#if defined(__AVX2__)
+    const __m256d k = _mm256_set1_pd(drag_k_);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256d vv = _mm256_loadu_pd(v + i);
+        _mm256_storeu_pd(out + i, _mm256_mul_pd(k, _mm256_mul_pd(vv, vv)));
+    }
+    for (; i < n; ++i) {
+        out[i] = drag_k_ * v[i] * v[i];
+    }
+#else
+    // Plain k*v*v loop - auto-vectorizes on contiguous input
+    for (size_t i = 0; i < n; ++i) {
+        out[i] = drag_k_ * v[i] * v[i];
+    }
+#endif
 }
 
-double AerodynamicsModel::getDragPower(double v) const {
-    // Power = Force × Velocity
-    return getDragForce(v) * v;
+void AerodynamicsModel::getDownforceBatch(const double* v, double* out, size_t n) const noexcept {
+#if defined(__AVX2__)
+    const __m256d k = _mm256_set1_pd(down_k_);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256d vv = _mm256_loadu_pd(v + i);
+        _mm256_storeu_pd(out + i, _mm256_mul_pd(k, _mm256_mul_pd(vv, vv)));
+    }
+    for (; i < n; ++i) {
+        out[i] = down_k_ * v[i] * v[i];
+    }
+#else
+    for (size_t i = 0; i < n; ++i) {
+        out[i] = down_k_ * v[i] * v[i];
+    }
+#endif
 }
 
 } // namespace LapTimeSim
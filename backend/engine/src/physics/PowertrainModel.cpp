@@ -9,47 +9,94 @@ PowertrainModel::PowertrainModel(const PowertrainParams& params, double tire_rad
     if (tire_radius_ <= 0.0) {
         throw std::invalid_argument("Tire radius must be positive");
     }
+    rebuildRatioCache();
 }
 
-double PowertrainModel::getRPM(double v, int gear) const {
+void PowertrainModel::rebuildRatioCache() {
+    size_t n_gears = params_.gear_ratios.size();
+    total_ratios_.resize(n_gears);
+    rpm_per_v_.resize(n_gears);
+    force_scale_.resize(n_gears);
+    gear_engage_speeds_.resize(n_gears);
+
+    // Gear selection targets the 70-90% of max RPM power band (see
+    // PowertrainParams::getOptimalGear); a gear is usable once
+    // v * rpm_per_v reaches that band's lower edge
+    double rpm_lo = std::max(params_.max_rpm * 0.70, params_.min_rpm);
+
+    for (size_t i = 0; i < n_gears; ++i) {
+        total_ratios_[i] = params_.gear_ratios[i] * params_.final_drive_ratio;
+        rpm_per_v_[i] = total_ratios_[i] / tire_radius_ * RAD_PER_S_TO_RPM;
+        force_scale_[i] = total_ratios_[i] * params_.drivetrain_efficiency / tire_radius_;
+        gear_engage_speeds_[i] = rpm_lo / rpm_per_v_[i];
+    }
+
+    // Resample the torque curve onto a uniform grid. The step targets
+    // 50 RPM but is snapped so the grid spans the curve exactly.
+    torque_table_.clear();
+    table_rpm_min_ = 0.0;
+    table_inv_step_ = 0.0;
+    if (!params_.engine_torque_curve.empty()) {
+        double rpm_first = params_.engine_torque_curve.front().first;
+        double rpm_last = params_.engine_torque_curve.back().first;
+        double span = rpm_last - rpm_first;
+        size_t n_segments = (span > 0.0)
+            ? std::max<size_t>(1, static_cast<size_t>(std::lround(span / 50.0)))
+            : 1;
+        double step = (span > 0.0) ? span / static_cast<double>(n_segments) : 1.0;
+
+        torque_table_.resize(n_segments + 1);
+        for (size_t i = 0; i <= n_segments; ++i) {
+            torque_table_[i] = params_.getTorqueAt(rpm_first + step * static_cast<double>(i));
+        }
+        torque_table_.back() = params_.engine_torque_curve.back().second;
+        table_rpm_min_ = rpm_first;
+        table_inv_step_ = 1.0 / step;
+    }
+
+    // Peak-power point of the torque curve, scanned once per rebuild
+    // instead of on every getPeakPowerRPM call
+    peak_power_rpm_ = 0.0;
+    double max_power = 0.0;
+    for (const auto& [rpm, torque] : params_.engine_torque_curve) {
+        double power = torque * (rpm * RPM_TO_RAD_PER_S);
+        if (power > max_power) {
+            max_power = power;
+            peak_power_rpm_ = rpm;
+        }
+    }
+}
+
+double PowertrainModel::getRPM(double v, int gear) const noexcept {
     if (!isValidGear(gear)) {
         return 0.0;
     }
-    
-    // RPM = (v / r) × gear_ratio × final_drive × 60 / (2π)
-    // where v/r is wheel angular velocity in rad/s
-    double wheel_angular_velocity = v / tire_radius_;
-    double total_ratio = getTotalGearRatio(gear);
-    double engine_angular_velocity = wheel_angular_velocity * total_ratio;
-    
-    // Convert rad/s to RPM
-    return engine_angular_velocity * 60.0 / (2.0 * PI);
+
+    // RPM = v × (total_ratio × 60 / (2π·r)), with the whole
+    // gear-dependent factor precomputed in rpm_per_v_
+    return v * rpm_per_v_[static_cast<size_t>(gear - 1)];
 }
 
 double PowertrainModel::getEngineTorque(double rpm) const {
-    return params_.getTorqueAt(rpm);
+    return lookupTorque(rpm);
 }
 
 double PowertrainModel::getWheelForce(double v, int gear) const {
     if (!isValidGear(gear) || v <= 0.0) {
         return 0.0;
     }
-    
-    double rpm = getRPM(v, gear);
-    
+
+    size_t g = static_cast<size_t>(gear - 1);
+    double rpm = v * rpm_per_v_[g];
+
     // Check if RPM is in valid range
     if (rpm < params_.min_rpm || rpm > params_.max_rpm) {
         return 0.0;  // Engine not in operating range
     }
-    
-    double engine_torque = getEngineTorque(rpm);
-    double total_ratio = getTotalGearRatio(gear);
-    
-    // Wheel torque = Engine torque × gear ratio × efficiency
-    double wheel_torque = engine_torque * total_ratio * params_.drivetrain_efficiency;
-    
-    // Wheel force = Wheel torque / tire radius
-    return wheel_torque / tire_radius_;
+
+    // force_scale_ folds gear ratio, efficiency, and 1/r into one
+    // factor, so the wheel force is a torque lookup and a multiply
+    return lookupTorque(rpm) * force_scale_[g];
 }
 
 double PowertrainModel::getMaxWheelForce(double v) const {
@@ -70,46 +117,119 @@ double PowertrainModel::getMaxWheelForce(double v) const {
     return max_force;
 }
 
+void PowertrainModel::getMaxWheelForceBatch(const double* v, double* out, size_t n) const {
+    for (size_t i = 0; i < n; ++i) {
+        out[i] = (v[i] <= 0.0) ? getWheelForce(0.01, 1) : 0.0;
+    }
+
+    // Gear-major order: the per-gear constants (ratio, rpm-per-velocity,
+    // force scale) are hoisted once, and the inner loop over velocities
+    // is a multiply, a range check, and a torque-curve interpolation -
+    // much friendlier to the branch predictor and the curve's search
+    // cursor than re-deriving everything per (v, gear) pair.
+    for (size_t g = 0; g < total_ratios_.size(); ++g) {
+        double rpm_per_v = rpm_per_v_[g];
+        double force_scale = force_scale_[g];
+
+        for (size_t i = 0; i < n; ++i) {
+            if (v[i] <= 0.0) continue;
+            double rpm = v[i] * rpm_per_v;
+            if (rpm < params_.min_rpm || rpm > params_.max_rpm) continue;
+            double force = lookupTorque(rpm) * force_scale;
+            out[i] = std::max(out[i], force);
+        }
+    }
+}
+
 int PowertrainModel::getOptimalGear(double v) const {
-    if (v <= 0.0) {
+    if (v <= 0.1 || gear_engage_speeds_.empty()) {
         return 1;
     }
-    
-    // Find peak power RPM
-    double target_rpm = getPeakPowerRPM();
-    
-    // Find gear that keeps engine closest to peak power RPM
-    return params_.getOptimalGear(v, tire_radius_, target_rpm);
-}
 
-double PowertrainModel::getMaxPower() const {
-    double max_power = 0.0;
-    
-    for (const auto& [rpm, torque] : params_.engine_torque_curve) {
-        // Power (W) = Torque (Nm) × Angular Velocity (rad/s)
-        double angular_velocity = rpm * 2.0 * PI / 60.0;
-        double power = torque * angular_velocity;
-        max_power = std::max(max_power, power);
+    // gear_engage_speeds_ is ascending (higher gears need more speed to
+    // stay in the power band), so the candidate set is a prefix of the
+    // gear list found by binary search - no per-gear RPM evaluation
+    // until the final check
+    auto it = std::upper_bound(gear_engage_speeds_.begin(), gear_engage_speeds_.end(), v);
+
+    // Highest engaged gear whose RPM does not exceed the limiter;
+    // lower gears only spin faster, so the first hit wins
+    for (int i = static_cast<int>(it - gear_engage_speeds_.begin()) - 1; i >= 0; --i) {
+        if (v * rpm_per_v_[i] <= params_.max_rpm) {
+            return i + 1;
+        }
     }
-    
-    return max_power * params_.drivetrain_efficiency;
+
+    // Fallback: any gear with RPM in the valid operating range
+    for (size_t i = 0; i < rpm_per_v_.size(); ++i) {
+        double rpm = v * rpm_per_v_[i];
+        if (rpm >= params_.min_rpm && rpm <= params_.max_rpm) {
+            return static_cast<int>(i + 1);
+        }
+    }
+
+    return 1;  // Default to first gear
 }
 
-double PowertrainModel::getPeakPowerRPM() const {
-    double max_power = 0.0;
-    double peak_rpm = 0.0;
-    
-    for (const auto& [rpm, torque] : params_.engine_torque_curve) {
-        double angular_velocity = rpm * 2.0 * PI / 60.0;
-        double power = torque * angular_velocity;
-        
-        if (power > max_power) {
-            max_power = power;
-            peak_rpm = rpm;
+void PowertrainModel::getOptimalGearsBulk(const double* v, int* gears_out,
+                                          double* rpm_out, size_t n) const {
+    const size_t n_gears = gear_engage_speeds_.size();
+    if (n_gears == 0) {
+        for (size_t i = 0; i < n; ++i) {
+            gears_out[i] = 1;
+            rpm_out[i] = getRPM(v[i], 1);
         }
+        return;
     }
-    
-    return peak_rpm;
+
+    const double* engage = gear_engage_speeds_.data();
+    const double* rpm_per_v = rpm_per_v_.data();
+    const double max_rpm = params_.max_rpm;
+    const double min_rpm = params_.min_rpm;
+
+    for (size_t i = 0; i < n; ++i) {
+        const double vi = v[i];
+        int gear = 1;
+        if (vi > 0.1) {
+            // Prefix count == upper_bound index on the ascending engage
+            // speeds, without the branchy bisection
+            int engaged = 0;
+            for (size_t g = 0; g < n_gears; ++g) {
+                engaged += (vi >= engage[g]) ? 1 : 0;
+            }
+
+            gear = 0;
+            for (int g = engaged - 1; g >= 0; --g) {
+                if (vi * rpm_per_v[g] <= max_rpm) {
+                    gear = g + 1;
+                    break;
+                }
+            }
+            if (gear == 0) {
+                for (size_t g = 0; g < n_gears; ++g) {
+                    double rpm = vi * rpm_per_v[g];
+                    if (rpm >= min_rpm && rpm <= max_rpm) {
+                        gear = static_cast<int>(g + 1);
+                        break;
+                    }
+                }
+                if (gear == 0) {
+                    gear = 1;  // Default to first gear
+                }
+            }
+        }
+
+        gears_out[i] = gear;
+        rpm_out[i] = vi * rpm_per_v[static_cast<size_t>(gear - 1)];
+    }
+}
+
+double PowertrainModel::getMaxPower() const {
+    return params_.getMaxEnginePower() * params_.drivetrain_efficiency;
+}
+
+double PowertrainModel::getPeakPowerRPM() const noexcept {
+    return peak_power_rpm_;
 }
 
 double PowertrainModel::getWheelPower(double v, int gear) const {
@@ -117,16 +237,15 @@ double PowertrainModel::getWheelPower(double v, int gear) const {
     return getWheelForce(v, gear) * v;
 }
 
-double PowertrainModel::getTotalGearRatio(int gear) const {
+double PowertrainModel::getTotalGearRatio(int gear) const noexcept {
     if (!isValidGear(gear)) {
         return 0.0;
     }
     
-    size_t gear_index = static_cast<size_t>(gear - 1);
-    return params_.gear_ratios[gear_index] * params_.final_drive_ratio;
+    return total_ratios_[static_cast<size_t>(gear - 1)];
 }
 
-bool PowertrainModel::isValidGear(int gear) const {
+bool PowertrainModel::isValidGear(int gear) const noexcept {
     return gear >= 1 && gear <= static_cast<int>(params_.gear_ratios.size());
 }
 
@@ -2,88 +2,74 @@
 #include <algorithm>
 #include <cmath>
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
 namespace LapTimeSim {
 
 TireModel::TireModel(const TireParams& params)
     : params_(params) {
+    rebuildDerived();
 }
 
-double TireModel::getMaxLongitudinalForce(double Fz) const {
+double TireModel::getMaxLongitudinalForce(double Fz) const noexcept {
     // F_x_max = μ_x × Fz (with load sensitivity)
     double mu_eff = getEffectiveMu(Fz, params_.mu_x);
     return mu_eff * Fz;
 }
 
-double TireModel::getMaxLateralForce(double Fz) const {
+double TireModel::getMaxLateralForce(double Fz) const noexcept {
     // F_y_max = μ_y × Fz (with load sensitivity)
     double mu_eff = getEffectiveMu(Fz, params_.mu_y);
     return mu_eff * Fz;
 }
 
-double TireModel::getAvailableLongitudinalForce(double Fz, double Fy_current) const {
-    // Friction ellipse: Fx² + Fy² ≤ (μ × Fz)²
-    // Solve for Fx: Fx = √((μ × Fz)² - Fy²)
-    
-    double F_max = getMaxTotalForce(Fz);
-    double Fy_squared = Fy_current * Fy_current;
-    double F_max_squared = F_max * F_max;
-    
-    if (Fy_squared >= F_max_squared) {
-        return 0.0;  // Already at or beyond friction limit
+void TireModel::getAvailableLongitudinalForceBatch(const double* Fz, const double* Fy,
+                                                   double* out, size_t n) const noexcept {
+#if defined(__AVX2__)
+    // Load-sensitivity constants hoisted so the mu computation below is
+    // a plain expression over the lane values
+    const double mu_avg = (params_.mu_x + params_.mu_y) / 2.0;
+    const double e = exponent_;
+    const double inv_ref = inv_fz_reference_;
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        // F_max per lane, exp2(e·log2) form written out so a vector
+        // math library (libmvec via omp simd) can batch the
+        // transcendentals; without one it runs as four scalar calls.
+        // The ellipse itself stays in explicit AVX2 below.
+        double f_max[4];
+#pragma omp simd
+        for (int k = 0; k < 4; ++k) {
+            double fz = Fz[i + k];
+            double mu = (fz > 0.0)
+                ? mu_avg * std::exp2(e * std::log2(fz * inv_ref))
+                : 0.0;
+            f_max[k] = mu * fz;
+        }
+        __m256d fm = _mm256_loadu_pd(f_max);
+        __m256d fy = _mm256_loadu_pd(Fy + i);
+        __m256d d2 = _mm256_sub_pd(_mm256_mul_pd(fm, fm), _mm256_mul_pd(fy, fy));
+        d2 = _mm256_max_pd(d2, _mm256_setzero_pd());
+        _mm256_storeu_pd(out + i, _mm256_sqrt_pd(d2));
     }
-    
-    return std::sqrt(F_max_squared - Fy_squared);
-}
-
-double TireModel::getAvailableLateralForce(double Fz, double Fx_current) const {
-    // Friction ellipse: Fx² + Fy² ≤ (μ × Fz)²
-    // Solve for Fy: Fy = √((μ × Fz)² - Fx²)
-    
-    double F_max = getMaxTotalForce(Fz);
-    double Fx_squared = Fx_current * Fx_current;
-    double F_max_squared = F_max * F_max;
-    
-    if (Fx_squared >= F_max_squared) {
-        return 0.0;  // Already at or beyond friction limit
+    for (; i < n; ++i) {
+        out[i] = getAvailableLongitudinalForce(Fz[i], Fy[i]);
     }
-    
-    return std::sqrt(F_max_squared - Fx_squared);
-}
-
-double TireModel::getEffectiveMu(double Fz, double base_mu) const {
-    return applyLoadSensitivity(Fz, base_mu);
-}
-
-double TireModel::applyLoadSensitivity(double Fz, double base_mu) const {
-    // Simple load sensitivity model
-    // Higher loads produce proportionally less grip
-    // μ_eff = μ_base × (Fz / Fz_ref)^(sensitivity - 1)
-    
-    // Use a reference load (e.g., typical static load per tire)
-    const double Fz_reference = 2000.0;  // N, approximately 200kg per tire
-    
-    if (Fz <= 0.0) return 0.0;
-    
-    double load_ratio = Fz / Fz_reference;
-    double exponent = params_.load_sensitivity - 1.0;
-    
-    return base_mu * std::pow(load_ratio, exponent);
+#else
+    for (size_t i = 0; i < n; ++i) {
+        out[i] = getAvailableLongitudinalForce(Fz[i], Fy[i]);
+    }
+#endif
 }
 
-bool TireModel::isWithinFrictionCircle(double Fx, double Fy, double Fz) const {
+bool TireModel::isWithinFrictionCircle(double Fx, double Fy, double Fz) const noexcept {
     double F_max = getMaxTotalForce(Fz);
     double F_combined = std::sqrt(Fx*Fx + Fy*Fy);
     return F_combined <= F_max;
 }
 
-double TireModel::getMaxTotalForce(double Fz) const {
-    // Use the average of longitudinal and lateral mu for total grip
-    // In practice, this could be more sophisticated
-    double mu_avg = (params_.mu_x + params_.mu_y) / 2.0;
-    double mu_eff = getEffectiveMu(Fz, mu_avg);
-    return mu_eff * Fz;
-}
-
 } // namespace LapTimeSim
 
 
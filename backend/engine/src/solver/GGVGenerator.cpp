@@ -1,20 +1,41 @@
 #include "solver/GGVGenerator.h"
 #include <algorithm>
 #include <cmath>
+#include <cstdio>
+#include <cstring>
 #include <fstream>
 #include <iostream>
 #include <stdexcept>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
 
 namespace LapTimeSim {
 
+namespace {
+
+// a + t*(b - a): one fused multiply-add per combine instead of two
+// multiplies and an add in the (1-t)/t form
+inline double lerp(double a, double b, double t) {
+    return std::fma(b - a, t, a);
+}
+
+} // namespace
+
 GGVGenerator::GGVGenerator(const VehicleParams& vehicle)
     : vehicle_(vehicle),
       aero_model_(vehicle.aero),
+      mass_(vehicle.mass.mass),
+      inv_mass_(1.0 / vehicle.mass.mass),
+      weight_(vehicle.mass.mass * VehicleParams::GRAVITY),
       tire_model_(vehicle.tire),
       powertrain_model_(vehicle.powertrain, vehicle.tire.tire_radius),
       generated_(false),
       v_min_(0), v_max_(0), v_step_(1),
-      ay_min_(0), ay_max_(0), ay_step_(1) {
+      ay_min_(0), ay_max_(0), ay_step_(1),
+      nv_(0), nay_(0), row_stride_(0) {
 }
 
 void GGVGenerator::generate(double v_min, double v_max, double v_step,
@@ -26,46 +47,116 @@ void GGVGenerator::generate(double v_min, double v_max, double v_step,
     ay_max_ = ay_max;
     ay_step_ = ay_step;
     
-    ggv_points_.clear();
-    
-    // Generate grid of (v, ay) points
-    for (double v = v_min; v <= v_max; v += v_step) {
-        for (double ay = 0.0; ay <= ay_max; ay += ay_step) {
-            GGVPoint point;
-            point.velocity = v;
-            point.ay_lateral = ay;
-            point.ax_max_accel = calculateMaxAcceleration(v, ay);
-            point.ax_max_brake = calculateMaxBraking(v, ay);
-            
-            ggv_points_.push_back(point);
+    // Dense grid dimensions (inclusive of both endpoints)
+    nv_ = static_cast<int>((v_max_ - v_min_) / v_step_) + 1;
+    nay_ = static_cast<int>((ay_max_ - ay_min_) / ay_step_) + 1;
+    row_stride_ = (nay_ + 3) & ~3;
+
+    ax_accel_grid_.assign(static_cast<size_t>(nv_) * row_stride_, 0.0);
+    ax_brake_grid_.assign(static_cast<size_t>(nv_) * row_stride_, 0.0);
+
+    // Aero forces depend only on v, not ay: sweep them once per
+    // velocity row with the batched (SIMD-friendly) aero kernels
+    // instead of recomputing them in every grid cell.
+    std::vector<double> v_row(nv_), f_drag_row(nv_), fz_row(nv_), fx_engine_row(nv_);
+    for (int iv = 0; iv < nv_; ++iv) {
+        // Same minimum-velocity clamp the per-cell physics uses
+        v_row[iv] = std::max(v_min_ + iv * v_step_, 0.1);
+    }
+    aero_model_.getDragForceBatch(v_row.data(), f_drag_row.data(), nv_);
+    aero_model_.getDownforceBatch(v_row.data(), fz_row.data(), nv_);
+    for (int iv = 0; iv < nv_; ++iv) {
+        fz_row[iv] += weight_;  // Total vertical load = weight + downforce
+    }
+
+    // The engine force also depends only on v; one gear-major batch
+    // sweep replaces nay_ redundant all-gears scans per velocity row
+    powertrain_model_.getMaxWheelForceBatch(v_row.data(), fx_engine_row.data(), nv_);
+
+    // With the v-dependent inputs hoisted, a whole velocity row shares
+    // one squared friction-circle radius - the form the ellipse kernel
+    // subtracts against, so the sqrt/re-square round trip disappears
+    std::vector<double> f_max_sq_row(nv_);
+    for (int iv = 0; iv < nv_; ++iv) {
+        f_max_sq_row[iv] = tire_model_.getMaxTotalForceSquared(fz_row[iv]);
+    }
+
+    // ay values padded to the row stride (repeating the last lane) so
+    // the vector loop may read a full group past nay_
+    std::vector<double> ay_row(row_stride_, ay_max_);
+    for (int iay = 0; iay < nay_; ++iay) {
+        ay_row[iay] = ay_min_ + iay * ay_step_;
+    }
+
+    // Fill grid of (v, ay) cells. Rows are independent pure
+    // computations over const vehicle models, so the outer loop is
+    // embarrassingly parallel; the inner ay sweep is a straight-line
+    // FP kernel vectorized 4 lanes wide.
+    #pragma omp parallel for schedule(static)
+    for (int iv = 0; iv < nv_; ++iv) {
+        double Fx_engine = fx_engine_row[iv];
+        double F_drag = f_drag_row[iv];
+
+        double* accel_out = ax_accel_grid_.data() + static_cast<size_t>(iv) * row_stride_;
+        double* brake_out = ax_brake_grid_.data() + static_cast<size_t>(iv) * row_stride_;
+        int iay = 0;
+
+#if defined(__AVX2__)
+        {
+            const __m256d vm = _mm256_set1_pd(mass_);
+            const __m256d vinv_m = _mm256_set1_pd(inv_mass_);
+            const __m256d vzero = _mm256_setzero_pd();
+            const __m256d vfmax2 = _mm256_set1_pd(f_max_sq_row[iv]);
+            const __m256d vengine = _mm256_set1_pd(Fx_engine);
+            const __m256d vdrag = _mm256_set1_pd(F_drag);
+            const __m256d vbrake_cap = _mm256_set1_pd(vehicle_.brake.max_brake_force);
+            const __m256d vaccel_cap = _mm256_set1_pd(50.0);
+            const __m256d vbrake_floor = _mm256_set1_pd(-60.0);
+            const __m256d vneg = _mm256_set1_pd(-0.0);
+
+            // Full 4-wide groups to the padded stride; the lanes past
+            // nay_ land in the row padding and are never read back
+            for (; iay < nay_; iay += 4) {
+                // Friction circle: Fx_tire = sqrt(max(0, F_max^2 - (m*ay)^2))
+                __m256d fy = _mm256_mul_pd(vm, _mm256_loadu_pd(ay_row.data() + iay));
+                __m256d d2 = _mm256_sub_pd(vfmax2, _mm256_mul_pd(fy, fy));
+                __m256d fx_tire = _mm256_sqrt_pd(_mm256_max_pd(vzero, d2));
+
+                // Acceleration: engine- or grip-limited, minus drag,
+                // clamped to [0, 50] m/s^2
+                __m256d fx_net = _mm256_sub_pd(_mm256_min_pd(vengine, fx_tire), vdrag);
+                __m256d ax = _mm256_mul_pd(fx_net, vinv_m);
+                _mm256_storeu_pd(accel_out + iay,
+                                 _mm256_max_pd(vzero, _mm256_min_pd(ax, vaccel_cap)));
+
+                // Braking: grip- or system-limited, drag helps; the
+                // sign flip is an XOR with -0.0
+                __m256d fx_brake = _mm256_add_pd(_mm256_min_pd(fx_tire, vbrake_cap), vdrag);
+                __m256d ax_b = _mm256_xor_pd(_mm256_mul_pd(fx_brake, vinv_m), vneg);
+                _mm256_storeu_pd(brake_out + iay, _mm256_max_pd(ax_b, vbrake_floor));
+            }
+        }
+#endif
+
+        for (; iay < nay_; ++iay) {
+            accel_out[iay] = calculateMaxAcceleration(ay_row[iay], fz_row[iv],
+                                                      F_drag, Fx_engine);
+            brake_out[iay] = calculateMaxBraking(v_row[iv], ay_row[iay],
+                                                 fz_row[iv], F_drag);
         }
     }
-    
+
     generated_ = true;
 }
 
-double GGVGenerator::calculateMaxAcceleration(double v, double ay) const {
-    const double g = VehicleParams::GRAVITY;
-    const double m = vehicle_.mass.mass;
-    
-    // Minimum velocity for calculations
-    if (v < 0.1) v = 0.1;
-    
-    // Calculate vertical load including downforce
-    double Fz_total = aero_model_.getTotalVerticalLoad(v, m, g);
-    
+double GGVGenerator::calculateMaxAcceleration(double ay, double Fz_total,
+                                              double F_drag, double Fx_engine) const {
     // Calculate lateral force required for current lateral acceleration
-    double Fy_required = m * ay;
-    
+    double Fy_required = mass_ * ay;
+
     // Get available longitudinal force from tire model (friction circle)
     double Fx_tire_max = tire_model_.getAvailableLongitudinalForce(Fz_total, Fy_required);
-    
-    // Get engine force
-    double Fx_engine = powertrain_model_.getMaxWheelForce(v);
-    
-    // Get drag force (negative acceleration)
-    double F_drag = aero_model_.getDragForce(v);
-    
+
     // Net force is limited by minimum of engine and tire grip
     double Fx_available = std::min(Fx_engine, Fx_tire_max);
     
@@ -73,51 +164,88 @@ double GGVGenerator::calculateMaxAcceleration(double v, double ay) const {
     double Fx_net = Fx_available - F_drag;
     
     // Acceleration = F / m
-    double ax = Fx_net / m;
+    double ax = Fx_net * inv_mass_;
     
     // Cannot accelerate backwards, and cap at reasonable F1 values
     return std::max(0.0, std::min(ax, 50.0));  // Cap at ~5g acceleration
 }
 
-double GGVGenerator::calculateMaxBraking(double v, double ay) const {
-    const double g = VehicleParams::GRAVITY;
-    const double m = vehicle_.mass.mass;
-    
-    // Minimum velocity for calculations
-    if (v < 0.1) v = 0.1;
-    
-    // Calculate vertical load including downforce
-    double Fz_total = aero_model_.getTotalVerticalLoad(v, m, g);
-    
+double GGVGenerator::calculateMaxBraking(double, double ay,
+                                         double Fz_total, double F_drag) const {
     // Calculate lateral force required
-    double Fy_required = m * ay;
-    
+    double Fy_required = mass_ * ay;
+
     // Get available longitudinal force from tire model
     double Fx_tire_max = tire_model_.getAvailableLongitudinalForce(Fz_total, Fy_required);
-    
+
     // Braking force is limited by tire grip and brake system
     double Fx_brake_system = vehicle_.brake.max_brake_force;
     double Fx_brake = std::min(Fx_tire_max, Fx_brake_system);
-    
-    // Drag helps with braking
-    double F_drag = aero_model_.getDragForce(v);
-    
-    // Net braking force (both negative)
+
+    // Net braking force (drag helps with braking; both negative)
     double Fx_net = -(Fx_brake + F_drag);
     
     // Deceleration = F / m (negative value)
-    double ax = Fx_net / m;
+    double ax = Fx_net * inv_mass_;
     
     // Cap at reasonable F1 braking values
     return std::max(ax, -60.0);  // Cap at ~6g braking
 }
 
+void GGVGenerator::getMaxAccelerationBulk(const double* v, const double* ay,
+                                          double* out, size_t n) const {
+    if (!generated_) {
+        throw std::runtime_error("GGV diagram has not been generated");
+    }
+    for (size_t i = 0; i < n; ++i) {
+        out[i] = interpolateGrid(ax_accel_grid_, v[i], std::abs(ay[i]));
+    }
+}
+
+void GGVGenerator::getMaxBrakingBulk(const double* v, const double* ay,
+                                     double* out, size_t n) const {
+    if (!generated_) {
+        throw std::runtime_error("GGV diagram has not been generated");
+    }
+    for (size_t i = 0; i < n; ++i) {
+        out[i] = interpolateGrid(ax_brake_grid_, v[i], std::abs(ay[i]));
+    }
+}
+
+double GGVGenerator::interpolateStraight(const std::vector<double>& grid, double v) const {
+    // ay = 0 is the first lane of every row, so the slice is a strided
+    // 1-D table over v; one lerp instead of the four-point bilinear
+    double v_idx_f = (v - v_min_) / v_step_;
+    v_idx_f = std::max(0.0, std::min(v_idx_f, static_cast<double>(nv_ - 1)));
+
+    int v_idx = static_cast<int>(v_idx_f);
+    v_idx = std::min(v_idx, nv_ - 2);
+    double v_t = v_idx_f - v_idx;
+
+    size_t base = static_cast<size_t>(v_idx) * row_stride_;
+    return lerp(grid[base], grid[base + row_stride_], v_t);
+}
+
+double GGVGenerator::getMaxAccelerationStraight(double v) const {
+    if (!generated_) {
+        throw std::runtime_error("GGV diagram has not been generated");
+    }
+    return interpolateStraight(ax_accel_grid_, v);
+}
+
+double GGVGenerator::getMaxBrakingStraight(double v) const {
+    if (!generated_) {
+        throw std::runtime_error("GGV diagram has not been generated");
+    }
+    return interpolateStraight(ax_brake_grid_, v);
+}
+
 double GGVGenerator::getMaxAcceleration(double v, double ay) const {
     if (!generated_) {
         throw std::runtime_error("GGV diagram has not been generated");
     }
     
-    return interpolateAcceleration(v, std::abs(ay));
+    return interpolateGrid(ax_accel_grid_, v, std::abs(ay));
 }
 
 double GGVGenerator::getMaxBraking(double v, double ay) const {
@@ -125,97 +253,114 @@ double GGVGenerator::getMaxBraking(double v, double ay) const {
         throw std::runtime_error("GGV diagram has not been generated");
     }
     
-    return interpolateBraking(v, std::abs(ay));
+    return interpolateGrid(ax_brake_grid_, v, std::abs(ay));
 }
 
-double GGVGenerator::interpolateAcceleration(double v, double ay) const {
-    // Clamp to valid range
+void GGVGenerator::getMaxAxRange(double v, double ay,
+                                 double& ax_accel, double& ax_brake) const {
+    if (!generated_) {
+        throw std::runtime_error("GGV diagram has not been generated");
+    }
+
+    // Same cell computation as interpolateGrid, done once for both
+    // grids: the index math and clamps are shared, and the two 2x2
+    // blocks sit at identical offsets so the second lookup reuses the
+    // already-resolved base index.
     v = std::max(v_min_, std::min(v_max_, v));
-    ay = std::max(0.0, std::min(ay_max_, ay));
-    
-    // Find surrounding grid points
+    ay = std::max(0.0, std::min(ay_max_, std::abs(ay)));
+
     double v_idx_f = (v - v_min_) / v_step_;
     double ay_idx_f = ay / ay_step_;
-    
+
     int v_idx = static_cast<int>(v_idx_f);
     int ay_idx = static_cast<int>(ay_idx_f);
-    
+    v_idx = std::min(v_idx, nv_ - 2);
+    ay_idx = std::min(ay_idx, nay_ - 2);
+
     double v_t = v_idx_f - v_idx;
     double ay_t = ay_idx_f - ay_idx;
-    
-    // Get values at four corners
-    int num_ay_points = static_cast<int>((ay_max_ - ay_min_) / ay_step_) + 1;
-    
-    auto getValue = [&](int vi, int ayi) -> double {
-        int index = vi * num_ay_points + ayi;
-        if (index >= 0 && index < static_cast<int>(ggv_points_.size())) {
-            return ggv_points_[index].ax_max_accel;
-        }
-        return 0.0;
-    };
-    
-    // Bilinear interpolation
-    double v00 = getValue(v_idx, ay_idx);
-    double v10 = getValue(v_idx + 1, ay_idx);
-    double v01 = getValue(v_idx, ay_idx + 1);
-    double v11 = getValue(v_idx + 1, ay_idx + 1);
-    
-    double v0 = v00 * (1 - v_t) + v10 * v_t;
-    double v1 = v01 * (1 - v_t) + v11 * v_t;
-    
-    return v0 * (1 - ay_t) + v1 * ay_t;
+    size_t base = static_cast<size_t>(v_idx) * row_stride_ + ay_idx;
+
+    {
+        double v0 = lerp(ax_accel_grid_[base], ax_accel_grid_[base + row_stride_], v_t);
+        double v1 = lerp(ax_accel_grid_[base + 1], ax_accel_grid_[base + row_stride_ + 1], v_t);
+        ax_accel = lerp(v0, v1, ay_t);
+    }
+    {
+        double v0 = lerp(ax_brake_grid_[base], ax_brake_grid_[base + row_stride_], v_t);
+        double v1 = lerp(ax_brake_grid_[base + 1], ax_brake_grid_[base + row_stride_ + 1], v_t);
+        ax_brake = lerp(v0, v1, ay_t);
+    }
 }
 
-double GGVGenerator::interpolateBraking(double v, double ay) const {
-    // Similar to interpolateAcceleration but for braking
+double GGVGenerator::interpolateGrid(const std::vector<double>& grid, double v, double ay) const {
+    // Clamp to valid range
     v = std::max(v_min_, std::min(v_max_, v));
     ay = std::max(0.0, std::min(ay_max_, ay));
-    
+
+    // Direct O(1) cell computation - the grid is regular
     double v_idx_f = (v - v_min_) / v_step_;
     double ay_idx_f = ay / ay_step_;
-    
+
     int v_idx = static_cast<int>(v_idx_f);
     int ay_idx = static_cast<int>(ay_idx_f);
-    
+
+    // Pre-clamp so (idx + 1) is always a valid neighbor
+    v_idx = std::min(v_idx, nv_ - 2);
+    ay_idx = std::min(ay_idx, nay_ - 2);
+
     double v_t = v_idx_f - v_idx;
     double ay_t = ay_idx_f - ay_idx;
-    
-    int num_ay_points = static_cast<int>((ay_max_ - ay_min_) / ay_step_) + 1;
-    
-    auto getValue = [&](int vi, int ayi) -> double {
-        int index = vi * num_ay_points + ayi;
-        if (index >= 0 && index < static_cast<int>(ggv_points_.size())) {
-            return ggv_points_[index].ax_max_brake;
-        }
-        return 0.0;
-    };
-    
-    double v00 = getValue(v_idx, ay_idx);
-    double v10 = getValue(v_idx + 1, ay_idx);
-    double v01 = getValue(v_idx, ay_idx + 1);
-    double v11 = getValue(v_idx + 1, ay_idx + 1);
-    
-    double v0 = v00 * (1 - v_t) + v10 * v_t;
-    double v1 = v01 * (1 - v_t) + v11 * v_t;
-    
-    return v0 * (1 - ay_t) + v1 * ay_t;
+
+    // Bilinear interpolation over the four neighboring grid values
+    size_t base = static_cast<size_t>(v_idx) * row_stride_ + ay_idx;
+    double v00 = grid[base];
+    double v01 = grid[base + 1];
+    double v10 = grid[base + row_stride_];
+    double v11 = grid[base + row_stride_ + 1];
+
+    double v0 = lerp(v00, v10, v_t);
+    double v1 = lerp(v01, v11, v_t);
+
+    return lerp(v0, v1, ay_t);
 }
 
 void GGVGenerator::exportToCSV(const std::string& filename) const {
-    std::ofstream file(filename);
+    std::ofstream file(filename, std::ios::binary);
     if (!file.is_open()) {
         throw std::runtime_error("Failed to open file for writing: " + filename);
     }
-    
-    file << "velocity_ms,lateral_accel_ms2,max_accel_ms2,max_brake_ms2\n";
-    
-    for (const auto& point : ggv_points_) {
-        file << point.velocity << ","
-             << point.ay_lateral << ","
-             << point.ax_max_accel << ","
-             << point.ax_max_brake << "\n";
+
+    // Format every row into one preallocated buffer and hand the OS a
+    // single write, instead of four locale-aware operator<< calls per
+    // grid cell. %g matches the default ostream formatting (6
+    // significant digits) the old code produced.
+    static const char header[] =
+        "velocity_ms,lateral_accel_ms2,max_accel_ms2,max_brake_ms2\n";
+    const size_t row_capacity = 96;
+    std::vector<char> buf(sizeof(header) +
+                          static_cast<size_t>(nv_) * nay_ * row_capacity);
+
+    size_t offset = sizeof(header) - 1;  // exclude the NUL
+    std::memcpy(buf.data(), header, offset);
+
+    for (int iv = 0; iv < nv_; ++iv) {
+        double v = v_min_ + iv * v_step_;
+        for (int iay = 0; iay < nay_; ++iay) {
+            double ay = ay_min_ + iay * ay_step_;
+            size_t index = static_cast<size_t>(iv) * row_stride_ + iay;
+            int written = std::snprintf(buf.data() + offset, row_capacity,
+                                        "%g,%g,%g,%g\n",
+                                        v, ay,
+                                        ax_accel_grid_[index],
+                                        ax_brake_grid_[index]);
+            if (written > 0) {
+                offset += static_cast<size_t>(written);
+            }
+        }
     }
-    
+
+    file.write(buf.data(), static_cast<std::streamsize>(offset));
     file.close();
 }
 
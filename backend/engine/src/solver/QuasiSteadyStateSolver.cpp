@@ -2,8 +2,13 @@
 #include <cmath>
 #include <algorithm>
 #include <stdexcept>
+#include <future>
 #include <iostream>
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
 namespace LapTimeSim {
 
 QuasiSteadyStateSolver::QuasiSteadyStateSolver(const TrackData& track, 
@@ -25,20 +30,44 @@ QuasiSteadyStateSolver::QuasiSteadyStateSolver(const TrackData& track,
     
     // Resize velocity vectors
     v_corner_.resize(n_points_, 0.0);
-    v_accel_.resize(n_points_, 0.0);
-    v_brake_.resize(n_points_, 0.0);
     v_optimal_.resize(n_points_, 0.0);
+
+    use_simd_kernels_ = SolverKernels::avx2Supported();
+
+    // Local copies of the integration loops' track columns
+    const TrackColumns& cols = track_.getColumns();
+    kappa_.assign(cols.kappa.begin(), cols.kappa.end());
+    ds_.assign(cols.ds.begin(), cols.ds.end());
+    abs_kappa_.resize(n_points_);
+    two_ds_.resize(n_points_);
+    for (size_t i = 0; i < n_points_; ++i) {
+        abs_kappa_[i] = std::abs(kappa_[i]);
+        // 2*ds is exact (power-of-two scale), so folding it here keeps
+        // the v^2 update bit-identical while dropping a multiply
+        two_ds_[i] = 2.0 * ds_[i];
+    }
     
     // Initialize models
     ggv_ = std::make_unique<GGVGenerator>(vehicle_);
     aero_ = std::make_unique<AerodynamicsModel>(vehicle_.aero);
     tire_ = std::make_unique<TireModel>(vehicle_.tire);
     powertrain_model_ = std::make_unique<PowertrainModel>(vehicle_.powertrain, vehicle_.tire.tire_radius);
+
+    // Bake the cornering-limit constants once; they are pure functions
+    // of the vehicle parameters, which are fixed for this solver's lifetime
+    const double m = vehicle_.mass.mass;
+    const double mu = vehicle_.tire.mu_y;
+    corner_num_ = mu * m * VehicleParams::GRAVITY;
+    corner_coef_a_ = m;
+    corner_coef_b_ = 0.5 * mu * vehicle_.aero.air_density
+                     * (-vehicle_.aero.Cl) * vehicle_.aero.frontal_area;
 }
 
 void QuasiSteadyStateSolver::initialize() {
-    std::cout << "Initializing solver..." << std::endl;
-    std::cout << "Generating GGV diagram..." << std::endl;
+    if (verbose_) {
+        std::cout << "Initializing solver..." << std::endl;
+        std::cout << "Generating GGV diagram..." << std::endl;
+    }
     
     // Generate GGV diagram
     // Velocity range: 0 to high speed for F1
@@ -48,59 +77,81 @@ void QuasiSteadyStateSolver::initialize() {
     // Lateral acceleration range: 0 to ~5g
     double ay_max = 50.0;  // m/s² (≈ 5g)
     double ay_step = 1.0;  // 1 m/s² resolution
-    
-    ggv_->generate(0.0, v_max, v_step, ay_max, ay_step);
-    
-    std::cout << "GGV diagram generated with v_max = " << v_max << " m/s (" 
-              << (v_max * 3.6) << " km/h)" << std::endl;
+
+    // The GGV grid and the cornering-limit profile are independent
+    // precomputes (the latter reads only the baked cornering
+    // coefficients), so they overlap: GGV fills on a worker thread
+    // while the cornering sweep runs here.
+    auto ggv_done = std::async(std::launch::async, [this, v_max, v_step, ay_max, ay_step] {
+        ggv_->generate(0.0, v_max, v_step, ay_max, ay_step);
+    });
+
+    calculateCorneringLimit();
+    ggv_done.get();
+
+    if (verbose_) {
+        std::cout << "GGV diagram generated with v_max = " << v_max << " m/s ("
+                  << (v_max * 3.6) << " km/h)" << std::endl;
+    }
 }
 
 double QuasiSteadyStateSolver::solve(int max_iterations, double tolerance) {
     initialize();
     
-    std::cout << "Starting quasi-steady-state solver..." << std::endl;
-    std::cout << "Track: " << n_points_ << " points, "
-              << track_.getTotalLength() << " m" << std::endl;
-    
-    // Calculate cornering limit once (doesn't change between iterations)
-    calculateCorneringLimit();
+    if (verbose_) {
+        std::cout << "Starting quasi-steady-state solver..." << std::endl;
+        std::cout << "Track: " << n_points_ << " points, "
+                  << track_.getTotalLength() << " m" << std::endl;
+    }
     
     // INITIALIZE: Start from realistic initial speed
     // Begin at moderate speed, not max cornering limit
     double initial_speed = 50.0;  // 50 m/s = 180 km/h (realistic rolling start)
-    
-    for (size_t i = 0; i < n_points_; ++i) {
-        // Start at minimum of initial speed or cornering limit
-        v_accel_[i] = std::min(initial_speed, v_corner_[i]);
-        v_brake_[i] = std::min(initial_speed, v_corner_[i]);
-    }
-    
+
+    // Only the seam values persist between iterations: each pass is a
+    // pure chain from its starting point, so the full acceleration and
+    // braking profiles never need to be materialized
+    v_accel_start_ = std::min(initial_speed, v_corner_[0]);
+    v_brake_end_ = std::min(initial_speed, v_corner_[n_points_ - 1]);
+
     double prev_lap_time = 1e9;
     converged_ = false;
     
     for (int iter = 0; iter < max_iterations; ++iter) {
         iterations_used_ = iter + 1;
-        
-        // Forward pass (acceleration)
+
+        // Both passes are deterministic chains from their seam seeds
+        // over fixed inputs (v_corner_, GGV). If neither seed moved
+        // during an iteration, the next iteration would reproduce
+        // v_optimal_ bit-for-bit - a fixed point, so stop right away
+        // instead of burning a full no-op sweep to measure a zero delta.
+        double seed_accel = v_accel_start_;
+        double seed_brake = v_brake_end_;
+
+        // Forward pass (acceleration) - seeds v_optimal_
         forwardIntegration();
-        
-        // Backward pass (braking)
+
+        // Backward pass (braking) - mins into v_optimal_
         backwardIntegration();
-        
-        // Combine profiles
-        combineProfiles();
-        
+
         // Calculate lap time
         lap_time_ = calculateLapTime();
         
-        std::cout << "Iteration " << (iter + 1) << ": Lap time = " 
-                  << lap_time_ << " s" << std::endl;
-        
+        if (verbose_) {
+            std::cout << "Iteration " << (iter + 1) << ": Lap time = "
+                      << lap_time_ << " s" << std::endl;
+        }
+
+        bool fixed_point = (v_accel_start_ == seed_accel) &&
+                           (v_brake_end_ == seed_brake);
+
         // Check convergence
         double lap_time_change = std::abs(lap_time_ - prev_lap_time);
-        if (lap_time_change < tolerance) {
+        if (fixed_point || lap_time_change < tolerance) {
             converged_ = true;
-            std::cout << "Converged!" << std::endl;
+            if (verbose_) {
+                std::cout << "Converged!" << std::endl;
+            }
             break;
         }
         
@@ -112,7 +163,9 @@ double QuasiSteadyStateSolver::solve(int max_iterations, double tolerance) {
                   << " iterations" << std::endl;
     }
     
-    std::cout << "Final lap time: " << lap_time_ << " seconds" << std::endl;
+    if (verbose_) {
+        std::cout << "Final lap time: " << lap_time_ << " seconds" << std::endl;
+    }
     
     return lap_time_;
 }
@@ -121,17 +174,38 @@ void QuasiSteadyStateSolver::calculateCorneringLimit() {
     int straight_count = 0;
     double max_v_corner = 0.0;
     double min_v_corner = 1e9;
-    
-    for (size_t i = 0; i < n_points_; ++i) {
-        const TrackPoint& point = track_.getPoint(i);
-        v_corner_[i] = solveCorneringVelocity(point.kappa);
-        
-        if (std::abs(point.kappa) < 0.002) {
+
+    // Runtime-dispatched vector kernel: 4 lanes of
+    // v = sqrt(num / (a*|kappa| - b)) with the straight-section and
+    // nonphysical-denominator branches as blends (see SolverKernels)
+    if (use_simd_kernels_) {
+        SolverKernels::cornerVelocities(abs_kappa_.data(), v_corner_.data(),
+                                        n_points_, corner_num_,
+                                        corner_coef_a_, corner_coef_b_);
+    } else {
+        // Scalar fallback; points are independent, so large tracks
+        // fan out across the OpenMP team (small ones stay serial -
+        // the fork costs more than the sweep)
+        #pragma omp parallel for schedule(static) if (n_points_ > 4096)
+        for (size_t i = 0; i < n_points_; ++i) {
+            v_corner_[i] = solveCorneringVelocity(kappa_[i]);
+        }
+    }
+
+    // The stats below exist only for the progress report
+    if (!verbose_) {
+        return;
+    }
+
+    #pragma omp parallel for schedule(static) if (n_points_ > 4096) \
+        reduction(+:straight_count) reduction(max:max_v_corner) \
+        reduction(min:min_v_corner)
+    for (size_t j = 0; j < n_points_; ++j) {
+        if (abs_kappa_[j] < 0.002) {
             straight_count++;
         }
-        
-        max_v_corner = std::max(max_v_corner, v_corner_[i]);
-        min_v_corner = std::min(min_v_corner, v_corner_[i]);
+        max_v_corner = std::max(max_v_corner, v_corner_[j]);
+        min_v_corner = std::min(min_v_corner, v_corner_[j]);
     }
     
     std::cout << "Cornering limits calculated:" << std::endl;
@@ -142,165 +216,192 @@ void QuasiSteadyStateSolver::calculateCorneringLimit() {
 }
 
 double QuasiSteadyStateSolver::solveCorneringVelocity(double kappa) const {
-    const double g = VehicleParams::GRAVITY;
-    const double m = vehicle_.mass.mass;
-    const double mu = vehicle_.tire.mu_y;
-    const double rho = vehicle_.aero.air_density;
-    const double Cl = vehicle_.aero.Cl;
-    const double A = vehicle_.aero.frontal_area;
-    
     // Handle straight or nearly-straight sections
     // Monza has long straights but with tiny curvature from track irregularities
     if (std::abs(kappa) < 0.002) {  // Less than 0.002 rad/m = radius > 500m = very gentle
         // For straights and gentle curves, return high speed
         return 110.0;  // ~396 km/h - reasonable F1 top speed at Monza
     }
-    
+
     // Solve: m × v² × |κ| = μ × (mg + 0.5 × ρ × v² × Cl × A)
     // Rearranging: v²(m|κ| - 0.5μρ(-Cl)A) = μmg
-    
-    double abs_kappa = std::abs(kappa);
-    double aero_factor = 0.5 * mu * rho * (-Cl) * A;  // Cl is negative for downforce
-    double denominator = m * abs_kappa - aero_factor;
-    double numerator = mu * m * g;
-    
+    // The coefficients are baked in the constructor (corner_num_ etc.)
+    double denominator = corner_coef_a_ * std::abs(kappa) - corner_coef_b_;
+
     if (denominator <= 0.0) {
         // Downforce contribution exceeds mechanical requirement
         // Still limited by straight-line max speed
         return 100.0;  // ~360 km/h
     }
-    
-    double v_squared = numerator / denominator;
-    
-    if (v_squared < 0.0) {
-        return 0.0;
-    }
-    
-    double v_corner = std::sqrt(v_squared);
-    
+
     // No artificial cap - let physics determine the limit
-    return v_corner;
+    return std::sqrt(corner_num_ / denominator);
 }
 
 void QuasiSteadyStateSolver::forwardIntegration() {
-    // Forward pass: accelerate from each point using maximum available force
-    // v_accel_ is already initialized in solve()
-    
-    for (size_t i = 0; i < n_points_ - 1; ++i) {
-        double v_start = std::max(v_accel_[i], 1.0);  // Never go below 1 m/s
-        const TrackPoint& point = track_.getPoint(i);
-        
-        // Calculate lateral acceleration at this point
-        double ay = v_start * v_start * std::abs(point.kappa);
-        
-        // Get maximum longitudinal acceleration from GGV
-        double ax_max = ggv_->getMaxAcceleration(v_start, ay);
-        
-        // Clamp acceleration to reasonable values
+    // Forward pass: accelerate from each point using maximum available force.
+    // The acceleration profile is a pure chain from v_accel_start_, so it
+    // lives in a scalar; each link is min'd with the cornering limit and
+    // written straight into v_optimal_ (the backward pass mins on top)
+
+    const AlignedDoubleVector& abs_kappa = abs_kappa_;
+    const AlignedDoubleVector& two_ds = two_ds_;
+
+    double v_chain = v_accel_start_;
+
+    // Single wrapped loop: iteration i integrates the link i -> i+1,
+    // with the final link wrapping to point 0 (the loop closure). The
+    // body is uniform; only the seam write differs, and that branch is
+    // taken exactly once, on the last iteration. The closure previously
+    // lived in a duplicated trailing block.
+    for (size_t i = 0; i < n_points_; ++i) {
+        size_t j = i + 1;
+        j = (j == n_points_) ? 0 : j;
+
+        double v_start = std::max(v_chain, 1.0);  // Never go below 1 m/s
+
+        // Get maximum longitudinal acceleration from GGV, clamped to
+        // reasonable values. Straight sections (the same |kappa|
+        // threshold solveCorneringVelocity uses) take the 1-D ay = 0
+        // fast path: the column is cache-hot and the branch runs in
+        // long predictable streaks down a straight.
+        double ax_max;
+        if (abs_kappa[i] < 0.002) {
+            ax_max = ggv_->getMaxAccelerationStraight(v_start);
+        } else {
+            double ay = v_start * v_start * abs_kappa[i];
+            ax_max = ggv_->getMaxAcceleration(v_start, ay);
+        }
         ax_max = std::min(ax_max, 50.0);
-        
+
         // Integrate forward: v²_end = v²_start + 2 × a × ds
-        double v_squared_end = v_start * v_start + 2.0 * ax_max * point.ds;
-        
-        double v_end = (v_squared_end > 0.0) ? std::sqrt(v_squared_end) : v_start;
-        
-        // Constrain by cornering limit at next point
-        v_accel_[i + 1] = std::min(v_end, v_corner_[i + 1]);
-        v_accel_[i + 1] = std::max(v_accel_[i + 1], 1.0);  // Minimum velocity
+        // ax_max >= 0 keeps v^2 positive; the max is belt-and-braces
+        // and keeps the sqrt unconditional (no mispredictable branch)
+        double v_squared_end = v_start * v_start + ax_max * two_ds[i];
+        double v_end = std::sqrt(std::max(v_squared_end, 0.0));
+
+        if (j == 0) {
+            // Loop closure: update the chain seed for the next iteration
+            v_accel_start_ = std::min(v_accel_start_,
+                                      std::min(v_end, v_corner_[0]));
+            v_optimal_[0] = v_accel_start_;
+        } else {
+            // Constrain by cornering limit at next point
+            v_chain = std::max(std::min(v_end, v_corner_[j]), 1.0);  // Minimum velocity
+            v_optimal_[j] = std::min(v_chain, v_corner_[j]);
+        }
     }
-    
-    // Handle the loop closure (last point to first)
-    size_t last = n_points_ - 1;
-    double v_start = v_accel_[last];
-    const TrackPoint& point = track_.getPoint(last);
-    double ay = v_start * v_start * std::abs(point.kappa);
-    double ax_max = ggv_->getMaxAcceleration(v_start, ay);
-    double v_squared_end = v_start * v_start + 2.0 * ax_max * point.ds;
-    double v_end = (v_squared_end > 0.0) ? std::sqrt(v_squared_end) : 0.0;
-    
-    // Update first point for next iteration
-    v_accel_[0] = std::min(v_accel_[0], std::min(v_end, v_corner_[0]));
 }
 
 void QuasiSteadyStateSolver::backwardIntegration() {
-    // Backward pass: determine braking points working backward from each corner
-    // v_brake_ is already initialized in solve()
-    
-    for (int i = static_cast<int>(n_points_) - 1; i > 0; --i) {
-        double v_start = std::max(v_brake_[i], 1.0);  // Never go below 1 m/s
-        
-        // Get the previous point's data
-        size_t i_prev = static_cast<size_t>(i - 1);
-        const TrackPoint& point_prev = track_.getPoint(i_prev);
-        
-        // Calculate lateral acceleration
-        double ay = v_start * v_start * std::abs(track_.getPoint(i).kappa);
-        
-        // Get maximum braking from GGV (negative value)
-        double ax_min = ggv_->getMaxBraking(v_start, ay);
-        
-        // Clamp braking to reasonable values
+    // Backward pass: determine braking points working backward from each
+    // corner. Like the forward pass, the braking profile is a scalar
+    // chain from v_brake_end_, min'd into v_optimal_ as it goes
+
+    const AlignedDoubleVector& abs_kappa = abs_kappa_;
+    const AlignedDoubleVector& two_ds = two_ds_;
+
+    double v_chain = v_brake_end_;
+
+    // Single wrapped loop, mirroring forwardIntegration: iteration i
+    // integrates the link i -> i-1, with i = 0 wrapping to the last
+    // point (the loop closure, previously a duplicated trailing block)
+    for (size_t i = n_points_; i-- > 0;) {
+        size_t i_prev = (i == 0) ? n_points_ - 1 : i - 1;
+
+        double v_start = std::max(v_chain, 1.0);  // Never go below 1 m/s
+
+        // Get maximum braking from GGV (negative value), clamped to
+        // reasonable values; straights take the 1-D fast path as in
+        // the forward pass
+        double ax_min;
+        if (abs_kappa[i] < 0.002) {
+            ax_min = ggv_->getMaxBrakingStraight(v_start);
+        } else {
+            double ay = v_start * v_start * abs_kappa[i];
+            ax_min = ggv_->getMaxBraking(v_start, ay);
+        }
         ax_min = std::max(ax_min, -60.0);
-        
+
         // Integrate backward: v²_prev = v²_curr - 2 × a × ds
         // (Note: ax_min is negative, so this actually increases v²)
-        double v_squared_prev = v_start * v_start - 2.0 * ax_min * point_prev.ds;
-        
-        double v_prev = (v_squared_prev > 0.0) ? std::sqrt(v_squared_prev) : v_start;
-        
-        // Constrain by cornering limit
-        v_brake_[i_prev] = std::min(v_prev, v_corner_[i_prev]);
-        v_brake_[i_prev] = std::max(v_brake_[i_prev], 1.0);  // Minimum velocity
-    }
-    
-    // Handle loop closure (first point to last)
-    double v_start = v_brake_[0];
-    const TrackPoint& last_point = track_.getPoint(n_points_ - 1);
-    double ay = v_start * v_start * std::abs(track_.getPoint(0).kappa);
-    double ax_min = ggv_->getMaxBraking(v_start, ay);
-    double v_squared_prev = v_start * v_start - 2.0 * ax_min * last_point.ds;
-    double v_prev = (v_squared_prev > 0.0) ? std::sqrt(v_squared_prev) : 0.0;
-    
-    // Update last point for next iteration
-    v_brake_[n_points_ - 1] = std::min(v_brake_[n_points_ - 1], 
-                                        std::min(v_prev, v_corner_[n_points_ - 1]));
-}
+        // ax_min <= 0 keeps v^2 at or above v_start^2; unconditional
+        // sqrt over the clamped value avoids the data-dependent branch
+        double v_squared_prev = v_start * v_start - ax_min * two_ds[i_prev];
+        double v_prev = std::sqrt(std::max(v_squared_prev, 0.0));
 
-void QuasiSteadyStateSolver::combineProfiles() {
-    for (size_t i = 0; i < n_points_; ++i) {
-        v_optimal_[i] = std::min({v_corner_[i], v_accel_[i], v_brake_[i]});
+        if (i == 0) {
+            // Loop closure: update the chain seed for the next iteration
+            v_brake_end_ = std::min(v_brake_end_,
+                                    std::min(v_prev, v_corner_[i_prev]));
+            v_optimal_[i_prev] = std::min(v_optimal_[i_prev], v_brake_end_);
+        } else {
+            // Constrain by cornering limit
+            v_chain = std::max(std::min(v_prev, v_corner_[i_prev]), 1.0);  // Minimum velocity
+            v_optimal_[i_prev] = std::min(v_optimal_[i_prev],
+                                          std::min(v_chain, v_corner_[i_prev]));
+        }
     }
 }
 
 double QuasiSteadyStateSolver::calculateLapTime() const {
+    if (use_simd_kernels_) {
+        return SolverKernels::lapTimeSum(ds_.data(), v_optimal_.data(), n_points_);
+    }
+
     double total_time = 0.0;
-    
+    #pragma omp parallel for schedule(static) if (n_points_ > 4096) \
+        reduction(+:total_time)
     for (size_t i = 0; i < n_points_; ++i) {
-        const TrackPoint& point = track_.getPoint(i);
-        
         if (v_optimal_[i] > 0.0) {
-            double dt = point.ds / v_optimal_[i];
-            total_time += dt;
+            total_time += ds_[i] / v_optimal_[i];
         }
     }
-    
     return total_time;
 }
 
 LapResult QuasiSteadyStateSolver::getDetailedResult() const {
     LapResult result;
     result.setLapTime(lap_time_);
-    
+    result.reserve(n_points_);  // One state per track point
+
+    // Reciprocal pre-pass: the timestamp walk is a serial chain, so the
+    // per-point divide would gate every step at divide latency. Inverting
+    // the whole velocity array first is a vectorizable independent loop,
+    // and the walk itself becomes one fma per point. Non-positive
+    // velocities map to a zero reciprocal, matching the old guard.
+    AlignedDoubleVector inv_v(n_points_);
+    for (size_t i = 0; i < n_points_; ++i) {
+        const double v = v_optimal_[i];
+        inv_v[i] = (v > 0.0) ? 1.0 / v : 0.0;
+    }
+
+    // Gear, RPM, and steering angle are pure per-point functions of
+    // arrays already in memory. Computing them in bulk keeps the gear
+    // tables hot across the sweep and exposes the atan loop to the
+    // vectorizer; createState then just copies the precomputed values.
+    std::vector<int> gears(n_points_);
+    AlignedDoubleVector rpms(n_points_);
+    powertrain_model_->getOptimalGearsBulk(v_optimal_.data(), gears.data(),
+                                           rpms.data(), n_points_);
+
+    AlignedDoubleVector steering(n_points_);
+    const double wheelbase = vehicle_.mass.wheelbase;
+    #pragma omp simd
+    for (size_t i = 0; i < n_points_; ++i) {
+        steering[i] = std::atan(wheelbase * kappa_[i]);
+    }
+
     double cumulative_time = 0.0;
-    
+
     for (size_t i = 0; i < n_points_; ++i) {
         SimulationState state = createState(i, cumulative_time);
+        state.steering_angle = steering[i];
+        state.gear = gears[i];
+        state.rpm = rpms[i];
         result.addState(state);
-        
-        const TrackPoint& point = track_.getPoint(i);
-        if (v_optimal_[i] > 0.0) {
-            cumulative_time += point.ds / v_optimal_[i];
-        }
+
+        cumulative_time = std::fma(ds_[i], inv_v[i], cumulative_time);
     }
     
     return result;
@@ -343,7 +444,7 @@ SimulationState QuasiSteadyStateSolver::createState(size_t index, double time) c
     
     // Track properties
     state.curvature = point.kappa;
-    state.radius = (std::abs(point.kappa) > 1e-6) ? (1.0 / std::abs(point.kappa)) : 1e9;
+    state.radius = (abs_kappa_[index] > 1e-6) ? (1.0 / abs_kappa_[index]) : 1e9;
     state.banking_angle = point.banking;
     
     // Forces
@@ -363,15 +464,10 @@ SimulationState QuasiSteadyStateSolver::createState(size_t index, double time) c
         state.brake = 0.0;
     }
     
-    // Steering (simplified)
-    state.steering_angle = std::atan(vehicle_.mass.wheelbase * point.kappa);
-    
     // Time
     state.timestamp = time;
-    
-    // Gear and RPM - calculate optimal gear for current speed
-    state.gear = powertrain_model_->getOptimalGear(v);
-    state.rpm = powertrain_model_->getRPM(v, state.gear);
+
+    // Steering, gear, and RPM are filled in bulk by getDetailedResult
     
     return state;
 }
@@ -0,0 +1,143 @@
+#include "solver/SolverKernels.h"
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#include <immintrin.h>
+#define LAP_SIM_AVX2_KERNELS 1
+// Compiled for AVX2+FMA independent of the baseline flags; only
+// entered after avx2Supported() has confirmed the CPU.
+#define LAP_SIM_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#else
+#define LAP_SIM_TARGET_AVX2
+#endif
+
+namespace LapTimeSim {
+namespace SolverKernels {
+
+bool avx2Supported() noexcept {
+#if defined(LAP_SIM_AVX2_KERNELS)
+    static const bool supported = [] {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+    }();
+    return supported;
+#else
+    return false;
+#endif
+}
+
+#if defined(LAP_SIM_AVX2_KERNELS)
+
+LAP_SIM_TARGET_AVX2
+void cornerVelocities(const double* abs_kappa, double* v_out, size_t n,
+                      double num, double coef_a, double coef_b) {
+    const __m256d vnum = _mm256_set1_pd(num);
+    const __m256d va = _mm256_set1_pd(coef_a);
+    const __m256d vb = _mm256_set1_pd(coef_b);
+    const __m256d vthresh = _mm256_set1_pd(0.002);
+    const __m256d vzero = _mm256_setzero_pd();
+    const __m256d vstraight = _mm256_set1_pd(110.0);
+    const __m256d vfallback = _mm256_set1_pd(100.0);
+
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256d ak = _mm256_loadu_pd(abs_kappa + i);
+        __m256d den = _mm256_sub_pd(_mm256_mul_pd(va, ak), vb);
+        __m256d v = _mm256_sqrt_pd(_mm256_div_pd(vnum, den));
+
+        // Blend order preserves the scalar precedence: the straight-
+        // section constant wins over the degenerate-denominator cap
+        __m256d bad_den = _mm256_cmp_pd(den, vzero, _CMP_LE_OQ);
+        v = _mm256_blendv_pd(v, vfallback, bad_den);
+        __m256d straight = _mm256_cmp_pd(ak, vthresh, _CMP_LT_OQ);
+        v = _mm256_blendv_pd(v, vstraight, straight);
+
+        _mm256_storeu_pd(v_out + i, v);
+    }
+
+    for (; i < n; ++i) {
+        double ak = abs_kappa[i];
+        if (ak < 0.002) {
+            v_out[i] = 110.0;
+            continue;
+        }
+        double den = coef_a * ak - coef_b;
+        v_out[i] = (den <= 0.0) ? 100.0 : std::sqrt(num / den);
+    }
+}
+
+LAP_SIM_TARGET_AVX2
+double lapTimeSum(const double* ds, const double* v, size_t n) {
+    double total_time = 0.0;
+    size_t i = 0;
+
+    // Streaming reduction over two arrays: four independent
+    // accumulators hide the divide latency, and the v > 0 guard becomes
+    // a mask so non-positive entries contribute exactly zero
+    if (n >= 16) {
+        const __m256d zero = _mm256_setzero_pd();
+        __m256d acc0 = zero, acc1 = zero, acc2 = zero, acc3 = zero;
+        for (; i + 16 <= n; i += 16) {
+            __m256d v0 = _mm256_loadu_pd(v + i);
+            __m256d v1 = _mm256_loadu_pd(v + i + 4);
+            __m256d v2 = _mm256_loadu_pd(v + i + 8);
+            __m256d v3 = _mm256_loadu_pd(v + i + 12);
+            __m256d t0 = _mm256_div_pd(_mm256_loadu_pd(ds + i), v0);
+            __m256d t1 = _mm256_div_pd(_mm256_loadu_pd(ds + i + 4), v1);
+            __m256d t2 = _mm256_div_pd(_mm256_loadu_pd(ds + i + 8), v2);
+            __m256d t3 = _mm256_div_pd(_mm256_loadu_pd(ds + i + 12), v3);
+            acc0 = _mm256_add_pd(acc0, _mm256_and_pd(t0, _mm256_cmp_pd(v0, zero, _CMP_GT_OQ)));
+            acc1 = _mm256_add_pd(acc1, _mm256_and_pd(t1, _mm256_cmp_pd(v1, zero, _CMP_GT_OQ)));
+            acc2 = _mm256_add_pd(acc2, _mm256_and_pd(t2, _mm256_cmp_pd(v2, zero, _CMP_GT_OQ)));
+            acc3 = _mm256_add_pd(acc3, _mm256_and_pd(t3, _mm256_cmp_pd(v3, zero, _CMP_GT_OQ)));
+        }
+        __m256d acc = _mm256_add_pd(_mm256_add_pd(acc0, acc1),
+                                    _mm256_add_pd(acc2, acc3));
+        double lanes[4];
+        _mm256_storeu_pd(lanes, acc);
+        total_time = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+    }
+
+    for (; i < n; ++i) {
+        if (v[i] > 0.0) {
+            total_time += ds[i] / v[i];
+        }
+    }
+
+    return total_time;
+}
+
+#else  // !LAP_SIM_AVX2_KERNELS
+
+// avx2Supported() returns false on these toolchains, so the kernels
+// are unreachable; the definitions exist only to satisfy the linker.
+
+void cornerVelocities(const double* abs_kappa, double* v_out, size_t n,
+                      double num, double coef_a, double coef_b) {
+    for (size_t i = 0; i < n; ++i) {
+        double ak = abs_kappa[i];
+        if (ak < 0.002) {
+            v_out[i] = 110.0;
+            continue;
+        }
+        double den = coef_a * ak - coef_b;
+        v_out[i] = (den <= 0.0) ? 100.0 : std::sqrt(num / den);
+    }
+}
+
+double lapTimeSum(const double* ds, const double* v, size_t n) {
+    double total_time = 0.0;
+    for (size_t i = 0; i < n; ++i) {
+        if (v[i] > 0.0) {
+            total_time += ds[i] / v[i];
+        }
+    }
+    return total_time;
+}
+
+#endif  // LAP_SIM_AVX2_KERNELS
+
+} // namespace SolverKernels
+} // namespace LapTimeSim
@@ -1,5 +1,9 @@
 #include "telemetry/TelemetryLogger.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
 #include <sstream>
+#include <vector>
 #include <cmath>
 
 namespace LapTimeSim {
@@ -8,7 +12,7 @@ TelemetryLogger::TelemetryLogger() {
 }
 
 void TelemetryLogger::printConsoleHeader() {
-    std::cout << std::string(120, '=') << std::endl;
+    std::cout << std::string(120, '=') << '\n';
     std::cout << std::setw(8) << "Time"
               << std::setw(10) << "Distance"
               << std::setw(10) << "Speed"
@@ -19,26 +23,27 @@ void TelemetryLogger::printConsoleHeader() {
               << std::setw(10) << "Brake"
               << std::setw(8) << "Gear"
               << std::setw(10) << "Curvature"
-              << std::endl;
-    std::cout << std::string(120, '=') << std::endl;
+              << '\n';
+    std::cout << std::string(120, '=') << '\n';
+    std::cout.flush();
 }
 
 void TelemetryLogger::logToConsole(const SimulationState& state, bool verbose) {
     if (verbose) {
         std::cout << "\n--- Telemetry at t=" << std::fixed << std::setprecision(3)
-                  << state.timestamp << "s ---" << std::endl;
-        std::cout << "Position: (" << state.x << ", " << state.y << ", " << state.z << ")" << std::endl;
-        std::cout << "Arc Length: " << state.s << " m" << std::endl;
-        std::cout << "Speed: " << state.v_kmh << " km/h (" << state.v << " m/s)" << std::endl;
-        std::cout << "Acceleration: ax=" << state.ax << " m/s², ay=" << state.ay << " m/s²" << std::endl;
-        std::cout << "G-Forces: gx=" << state.gx << ", gy=" << state.gy << ", total=" << state.g_total << std::endl;
+                  << state.timestamp << "s ---" << '\n';
+        std::cout << "Position: (" << state.x << ", " << state.y << ", " << state.z << ")" << '\n';
+        std::cout << "Arc Length: " << state.s << " m" << '\n';
+        std::cout << "Speed: " << state.v_kmh << " km/h (" << state.v << " m/s)" << '\n';
+        std::cout << "Acceleration: ax=" << state.ax << " m/s², ay=" << state.ay << " m/s²" << '\n';
+        std::cout << "G-Forces: gx=" << state.gx << ", gy=" << state.gy << ", total=" << state.g_total << '\n';
         std::cout << "Controls: Throttle=" << (state.throttle * 100) << "%, Brake=" 
-                  << (state.brake * 100) << "%" << std::endl;
-        std::cout << "Powertrain: Gear=" << state.gear << ", RPM=" << state.rpm << std::endl;
+                  << (state.brake * 100) << "%" << '\n';
+        std::cout << "Powertrain: Gear=" << state.gear << ", RPM=" << state.rpm << '\n';
         std::cout << "Forces: Drag=" << state.drag_force << "N, Downforce=" 
-                  << state.downforce << "N" << std::endl;
+                  << state.downforce << "N" << '\n';
         std::cout << "Track: Curvature=" << state.curvature << " (1/m), Radius=" 
-                  << state.radius << " m" << std::endl;
+                  << state.radius << " m" << '\n';
     } else {
         // Compact format
         std::cout << std::fixed << std::setprecision(2)
@@ -52,137 +57,164 @@ void TelemetryLogger::logToConsole(const SimulationState& state, bool verbose) {
                   << std::setw(10) << (state.brake * 100)
                   << std::setw(8) << state.gear
                   << std::setw(10) << state.curvature
-                  << std::endl;
+                  << '\n';
     }
 }
 
 void TelemetryLogger::exportToCSV(const LapResult& result, const std::string& filename) {
-    std::ofstream file(filename);
+    std::ofstream file(filename, std::ios::binary);
     if (!file.is_open()) {
-        std::cerr << "Error: Could not open file " << filename << " for writing" << std::endl;
+        std::cerr << "Error: Could not open file " << filename << " for writing" << '\n';
         return;
     }
-    
-    // CSV Header
-    file << "timestamp_s,arc_length_m,pos_x_m,pos_y_m,pos_z_m,lateral_offset_m,"
-         << "speed_ms,speed_kmh,accel_long_ms2,accel_lat_ms2,accel_vert_ms2,"
-         << "g_long,g_lat,g_vert,g_total,"
-         << "throttle_pct,brake_pct,steering_angle_rad,"
-         << "gear,rpm,engine_torque_nm,wheel_force_n,"
-         << "drag_force_n,downforce_n,tire_force_long_n,tire_force_lat_n,vertical_load_n,"
-         << "curvature_inv_m,radius_m,banking_rad\n";
-    
-    // Data rows
-    const auto& states = result.getStates();
-    for (const auto& state : states) {
-        file << std::fixed << std::setprecision(6)
-             << state.timestamp << ","
-             << state.s << ","
-             << state.x << ","
-             << state.y << ","
-             << state.z << ","
-             << state.n << ","
-             << state.v << ","
-             << state.v_kmh << ","
-             << state.ax << ","
-             << state.ay << ","
-             << state.az << ","
-             << state.gx << ","
-             << state.gy << ","
-             << state.gz << ","
-             << state.g_total << ","
-             << (state.throttle * 100) << ","
-             << (state.brake * 100) << ","
-             << state.steering_angle << ","
-             << state.gear << ","
-             << state.rpm << ","
-             << state.engine_torque << ","
-             << state.wheel_force << ","
-             << state.drag_force << ","
-             << state.downforce << ","
-             << state.tire_force_x << ","
-             << state.tire_force_y << ","
-             << state.vertical_load << ","
-             << state.curvature << ","
-             << state.radius << ","
-             << state.banking_angle << "\n";
+
+    // Format the whole file into one owned buffer, then issue a single
+    // write. Per-field operator<< pushes every value through the
+    // stream's locale/sentry machinery and its 4 KB buffer; one
+    // snprintf per row into a flat buffer avoids all of that.
+    static const char header[] =
+        "timestamp_s,arc_length_m,pos_x_m,pos_y_m,pos_z_m,lateral_offset_m,"
+        "speed_ms,speed_kmh,accel_long_ms2,accel_lat_ms2,accel_vert_ms2,"
+        "g_long,g_lat,g_vert,g_total,"
+        "throttle_pct,brake_pct,steering_angle_rad,"
+        "gear,rpm,engine_torque_nm,wheel_force_n,"
+        "drag_force_n,downforce_n,tire_force_long_n,tire_force_lat_n,vertical_load_n,"
+        "curvature_inv_m,radius_m,banking_rad\n";
+
+    // 30 fields at %.6f is well under 768 bytes per row, even with the
+    // sentinel 1e9 radius on straights; the snprintf bound below is the
+    // true remaining space, so a pathological row (huge coordinates in
+    // the source track) truncates instead of overflowing
+    const size_t row_capacity = 768;
+    std::vector<char> buf(sizeof(header) + result.size() * row_capacity);
+
+    size_t offset = sizeof(header) - 1;  // Drop the string literal's NUL
+    std::memcpy(buf.data(), header, offset);
+
+    for (size_t i = 0; i < result.size(); ++i) {
+        SimulationState state = result.at(i);
+        const size_t remaining = buf.size() - offset;
+        int written = std::snprintf(
+            buf.data() + offset, remaining,
+            "%.6f,%.6f,%.6f,%.6f,%.6f,%.6f,"
+            "%.6f,%.6f,%.6f,%.6f,%.6f,"
+            "%.6f,%.6f,%.6f,%.6f,"
+            "%.6f,%.6f,%.6f,"
+            "%d,%.6f,%.6f,%.6f,"
+            "%.6f,%.6f,%.6f,%.6f,%.6f,"
+            "%.6f,%.6f,%.6f\n",
+            state.timestamp, state.s, state.x, state.y, state.z, state.n,
+            state.v, state.v_kmh, state.ax, state.ay, state.az,
+            state.gx, state.gy, state.gz, state.g_total,
+            state.throttle * 100, state.brake * 100, state.steering_angle,
+            state.gear, state.rpm, state.engine_torque, state.wheel_force,
+            state.drag_force, state.downforce, state.tire_force_x,
+            state.tire_force_y, state.vertical_load,
+            state.curvature, state.radius, state.banking_angle);
+        if (written > 0) {
+            // snprintf reports the untruncated length; advance only by
+            // the bytes actually stored so offset can never outrun the
+            // buffer
+            offset += std::min(static_cast<size_t>(written), remaining - 1);
+        }
     }
-    
+
+    file.write(buf.data(), static_cast<std::streamsize>(offset));
     file.close();
-    std::cout << "Telemetry exported to CSV: " << filename << std::endl;
+    std::cout << "Telemetry exported to CSV: " << filename << '\n';
 }
 
 void TelemetryLogger::exportToJSON(const LapResult& result, const std::string& filename) {
-    std::ofstream file(filename);
+    std::ofstream file(filename, std::ios::binary);
     if (!file.is_open()) {
-        std::cerr << "Error: Could not open file " << filename << " for writing" << std::endl;
+        std::cerr << "Error: Could not open file " << filename << " for writing" << '\n';
         return;
     }
-    
-    file << "{\n";
-    file << "  \"lap_time_seconds\": " << result.getLapTime() << ",\n";
-    file << "  \"telemetry\": [\n";
-    
-    const auto& states = result.getStates();
-    for (size_t i = 0; i < states.size(); ++i) {
-        const auto& state = states[i];
-        
-        file << "    {\n";
-        file << "      \"timestamp\": " << state.timestamp << ",\n";
-        file << "      \"position\": {\"x\": " << state.x << ", \"y\": " << state.y 
-             << ", \"z\": " << state.z << ", \"s\": " << state.s << "},\n";
-        file << "      \"velocity\": {\"ms\": " << state.v << ", \"kmh\": " << state.v_kmh << "},\n";
-        file << "      \"acceleration\": {\"longitudinal\": " << state.ax 
-             << ", \"lateral\": " << state.ay << ", \"vertical\": " << state.az << "},\n";
-        file << "      \"g_forces\": {\"gx\": " << state.gx << ", \"gy\": " << state.gy 
-             << ", \"gz\": " << state.gz << ", \"total\": " << state.g_total << "},\n";
-        file << "      \"controls\": {\"throttle_pct\": " << (state.throttle * 100) 
-             << ", \"brake_pct\": " << (state.brake * 100) 
-             << ", \"steering_rad\": " << state.steering_angle << "},\n";
-        file << "      \"powertrain\": {\"gear\": " << state.gear << ", \"rpm\": " << state.rpm << "},\n";
-        file << "      \"forces\": {\"drag\": " << state.drag_force << ", \"downforce\": " 
-             << state.downforce << ", \"vertical_load\": " << state.vertical_load << "},\n";
-        file << "      \"track\": {\"curvature\": " << state.curvature << ", \"radius\": " 
-             << state.radius << ", \"banking\": " << state.banking_angle << "}\n";
-        file << "    }";
-        
-        if (i < states.size() - 1) {
-            file << ",";
+
+    // Same buffered scheme as the CSV exporter: every record is
+    // snprintf'd into one preallocated buffer and the whole document
+    // goes out in a single write. %g matches the default ostream
+    // formatting the old per-field inserts produced.
+    const size_t record_capacity = 1280;
+    std::vector<char> buf(64 + result.size() * record_capacity);
+
+    size_t offset = 0;
+    int written = std::snprintf(buf.data(), buf.size(),
+                                "{\n  \"lap_time_seconds\": %g,\n  \"telemetry\": [\n",
+                                result.getLapTime());
+    if (written > 0) {
+        offset = std::min(static_cast<size_t>(written), buf.size() - 1);
+    }
+
+    for (size_t i = 0; i < result.size(); ++i) {
+        SimulationState state = result.at(i);
+
+        const size_t remaining = buf.size() - offset;
+        written = std::snprintf(buf.data() + offset, remaining,
+            "    {\n"
+            "      \"timestamp\": %g,\n"
+            "      \"position\": {\"x\": %g, \"y\": %g, \"z\": %g, \"s\": %g},\n"
+            "      \"velocity\": {\"ms\": %g, \"kmh\": %g},\n"
+            "      \"acceleration\": {\"longitudinal\": %g, \"lateral\": %g, \"vertical\": %g},\n"
+            "      \"g_forces\": {\"gx\": %g, \"gy\": %g, \"gz\": %g, \"total\": %g},\n"
+            "      \"controls\": {\"throttle_pct\": %g, \"brake_pct\": %g, \"steering_rad\": %g},\n"
+            "      \"powertrain\": {\"gear\": %d, \"rpm\": %g},\n"
+            "      \"forces\": {\"drag\": %g, \"downforce\": %g, \"vertical_load\": %g},\n"
+            "      \"track\": {\"curvature\": %g, \"radius\": %g, \"banking\": %g}\n"
+            "    }%s\n",
+            state.timestamp,
+            state.x, state.y, state.z, state.s,
+            state.v, state.v_kmh,
+            state.ax, state.ay, state.az,
+            static_cast<double>(state.gx), static_cast<double>(state.gy),
+            static_cast<double>(state.gz), static_cast<double>(state.g_total),
+            state.throttle * 100, state.brake * 100, state.steering_angle,
+            state.gear, state.rpm,
+            state.drag_force, state.downforce, state.vertical_load,
+            state.curvature, state.radius, state.banking_angle,
+            (i < result.size() - 1) ? "," : "");
+        if (written > 0) {
+            // Advance by the bytes actually stored, as in the CSV
+            // exporter, so offset stays inside the buffer even if a
+            // record is ever truncated
+            offset += std::min(static_cast<size_t>(written), remaining - 1);
         }
-        file << "\n";
     }
-    
-    file << "  ]\n";
-    file << "}\n";
-    
+
+    written = std::snprintf(buf.data() + offset, buf.size() - offset, "  ]\n}\n");
+    if (written > 0) {
+        offset += std::min(static_cast<size_t>(written), buf.size() - offset - 1);
+    }
+
+    file.write(buf.data(), static_cast<std::streamsize>(offset));
     file.close();
-    std::cout << "Telemetry exported to JSON: " << filename << std::endl;
+    std::cout << "Telemetry exported to JSON: " << filename << '\n';
 }
 
 void TelemetryLogger::printSummary(const LapResult& result, 
                                    const TrackData& track,
                                    const VehicleParams& vehicle) {
-    std::cout << "\n" << std::string(80, '=') << std::endl;
-    std::cout << "                    LAP TIME SIMULATION SUMMARY" << std::endl;
-    std::cout << std::string(80, '=') << std::endl;
+    std::cout << "\n" << std::string(80, '=') << '\n';
+    std::cout << "                    LAP TIME SIMULATION SUMMARY" << '\n';
+    std::cout << std::string(80, '=') << '\n';
     
     // Track info
-    std::cout << "\nTrack: " << track.getName() << std::endl;
-    std::cout << "  Length: " << track.getTotalLength() << " m" << std::endl;
-    std::cout << "  Points: " << track.getNumPoints() << std::endl;
+    std::cout << "\nTrack: " << track.getName() << '\n';
+    std::cout << "  Length: " << track.getTotalLength() << " m" << '\n';
+    std::cout << "  Points: " << track.getNumPoints() << '\n';
     
     // Vehicle info
-    std::cout << "\nVehicle: " << vehicle.getName() << std::endl;
-    std::cout << "  Mass: " << vehicle.mass.mass << " kg" << std::endl;
+    std::cout << "\nVehicle: " << vehicle.getName() << '\n';
+    std::cout << "  Mass: " << vehicle.mass.mass << " kg" << '\n';
     std::cout << "  Power/Weight: " << std::fixed << std::setprecision(2) 
-              << vehicle.getPowerToWeightRatio() << " hp/kg" << std::endl;
-    std::cout << "  Aero: Cd=" << vehicle.aero.Cd << ", Cl=" << vehicle.aero.Cl << std::endl;
+              << vehicle.getPowerToWeightRatio() << " hp/kg" << '\n';
+    std::cout << "  Aero: Cd=" << vehicle.aero.Cd << ", Cl=" << vehicle.aero.Cl << '\n';
     
     // Lap time
-    std::cout << "\n" << std::string(80, '-') << std::endl;
+    std::cout << "\n" << std::string(80, '-') << '\n';
     std::cout << "OPTIMAL LAP TIME: " << std::fixed << std::setprecision(3) 
-              << result.getLapTime() << " seconds" << std::endl;
-    std::cout << std::string(80, '-') << std::endl;
+              << result.getLapTime() << " seconds" << '\n';
+    std::cout << std::string(80, '-') << '\n';
     
     // Statistics
     double max_speed = result.getMaxSpeed();
@@ -190,16 +222,17 @@ void TelemetryLogger::printSummary(const LapResult& result,
     double max_gx, max_gy, max_g_total;
     result.getMaxGForces(max_gx, max_gy, max_g_total);
     
-    std::cout << "\nPerformance Statistics:" << std::endl;
+    std::cout << "\nPerformance Statistics:" << '\n';
     std::cout << "  Maximum Speed: " << (max_speed * 3.6) << " km/h (" 
-              << max_speed << " m/s)" << std::endl;
+              << max_speed << " m/s)" << '\n';
     std::cout << "  Average Speed: " << (avg_speed * 3.6) << " km/h (" 
-              << avg_speed << " m/s)" << std::endl;
-    std::cout << "  Max Longitudinal G: " << max_gx << " g" << std::endl;
-    std::cout << "  Max Lateral G: " << max_gy << " g" << std::endl;
-    std::cout << "  Max Total G: " << max_g_total << " g" << std::endl;
+              << avg_speed << " m/s)" << '\n';
+    std::cout << "  Max Longitudinal G: " << max_gx << " g" << '\n';
+    std::cout << "  Max Lateral G: " << max_gy << " g" << '\n';
+    std::cout << "  Max Total G: " << max_g_total << " g" << '\n';
     
-    std::cout << "\n" << std::string(80, '=') << std::endl;
+    std::cout << "\n" << std::string(80, '=') << '\n';
+    std::cout.flush();
 }
 
 std::string TelemetryLogger::formatTime(double seconds) const {